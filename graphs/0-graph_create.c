@@ -16,7 +16,22 @@ graph_t *graph_create(void)
 		return (NULL);
 
 	graph->nb_vertices = 0;
+	graph->nb_indices = 0;
 	graph->vertices = NULL;
+	graph->vertices_tail = NULL;
+	graph->table = NULL;
+	graph->table_size = 0;
+	graph->by_index = NULL;
+	graph->by_index_size = 0;
+	graph->arena = NULL;
+	graph->weighted = 0;
+	graph->strings.table = NULL;
+	graph->strings.size = 0;
+	graph->strings.count = 0;
+	graph->strings.arena = NULL;
+	graph->in_index = NULL;
+	graph->edge_index = 0;
+	graph->unique_edges = 0;
 
 	return (graph);
 }
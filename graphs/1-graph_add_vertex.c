@@ -6,50 +6,51 @@
  * graph_add_vertex - Adds a vertex to an existing graph
  *
  * @graph: Pointer to the graph to add the vertex to
- * @str: String to store in the new vertex
+ * @str: String to store in the new vertex, interned in the string pool of
+ *   the graph (see graph_intern)
  *
  * Return: Pointer to the created vertex, or NULL on failure
  */
 vertex_t *graph_add_vertex(graph_t *graph, const char *str)
 {
-	vertex_t *new_vertex, *last_vertex;
+	vertex_t *new_vertex, **slot;
 
 	if (graph == NULL || str == NULL)
 		return (NULL);
 
 	/* Check for duplicate */
-	last_vertex = graph->vertices;
-	while (last_vertex)
-	{
-		if (strcmp(last_vertex->content, str) == 0)
-			return (NULL);
-		if (last_vertex->next == NULL)
-			break;
-		last_vertex = last_vertex->next;
-	}
+	if (!graph_hash_reserve(graph, graph->nb_vertices + 1) ||
+	    !graph_index_reserve(graph, graph->nb_indices + 1))
+		return (NULL);
+	slot = graph_hash_slot(graph, str);
+	if (*slot)
+		return (NULL);
 
-	new_vertex = malloc(sizeof(vertex_t));
+	new_vertex = graph_alloc(graph, sizeof(vertex_t));
 	if (new_vertex == NULL)
 		return (NULL);
+	memset(new_vertex, 0, sizeof(vertex_t));
 
-	new_vertex->content = strdup(str);
+	new_vertex->content = (char *)graph_intern(graph, str);
 	if (new_vertex->content == NULL)
 	{
-		free(new_vertex);
+		if (!graph->arena)
+			free(new_vertex);
 		return (NULL);
 	}
-
-	new_vertex->index = graph->nb_vertices;
-	new_vertex->nb_edges = 0;
-	new_vertex->edges = NULL;
-	new_vertex->next = NULL;
+	new_vertex->index = graph->nb_indices;
+	new_vertex->prev = graph->vertices_tail;
 
 	if (graph->vertices == NULL)
 		graph->vertices = new_vertex;
 	else
-		last_vertex->next = new_vertex;
+		graph->vertices_tail->next = new_vertex;
+	graph->vertices_tail = new_vertex;
+	*slot = new_vertex;
+	graph->by_index[new_vertex->index] = new_vertex;
 
 	graph->nb_vertices++;
+	graph->nb_indices++;
 
 	return (new_vertex);
 }
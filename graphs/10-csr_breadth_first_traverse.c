@@ -0,0 +1,82 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * csr_bfs - Processes the BFS queue over a CSR snapshot
+ *
+ * @csr: Pointer to the snapshot to traverse
+ * @queue: Queue of vertex indices, able to hold every vertex
+ * @depths: Depth of each queued vertex
+ * @visited: Array of visited flags, zeroed
+ * @action: Action to perform on each vertex
+ *
+ * Return: The maximum depth reached
+ */
+static size_t csr_bfs(const graph_csr_t *csr, size_t *queue, size_t *depths,
+		      unsigned char *visited,
+		      void (*action)(const vertex_t *v, size_t depth))
+{
+	size_t read = 0, write = 1, max_depth = 0, u, w, i;
+
+	queue[0] = csr->head;
+	depths[0] = 0;
+	visited[csr->head] = 1;
+
+	while (read < write)
+	{
+		u = queue[read];
+		if (depths[read] > max_depth)
+			max_depth = depths[read];
+
+		action(csr->vertices[u], depths[read]);
+
+		for (i = csr->offsets[u]; i < csr->offsets[u + 1]; i++)
+		{
+			w = csr->targets[i];
+			if (!visited[w])
+			{
+				visited[w] = 1;
+				queue[write] = w;
+				depths[write] = depths[read] + 1;
+				write++;
+			}
+		}
+		read++;
+	}
+	return (max_depth);
+}
+
+/**
+ * csr_breadth_first_traverse - Goes through a CSR snapshot of a graph using
+ * the breadth-first algorithm
+ *
+ * @csr: Pointer to the snapshot to traverse
+ * @action: Pointer to the function to be called for each visited vertex
+ *
+ * Vertices are visited in the same order as breadth_first_traverse would
+ * visit them on the frozen graph.
+ *
+ * Return: The biggest vertex depth, or 0 on failure
+ */
+size_t csr_breadth_first_traverse(const graph_csr_t *csr,
+				  void (*action)(const vertex_t *v,
+						 size_t depth))
+{
+	unsigned char *visited;
+	size_t *queue, *depths;
+	size_t max_depth = 0;
+
+	if (!csr || !csr->nb_vertices || !action)
+		return (0);
+
+	visited = calloc(csr->nb_vertices, sizeof(unsigned char));
+	queue = malloc(csr->nb_vertices * sizeof(size_t));
+	depths = malloc(csr->nb_vertices * sizeof(size_t));
+	if (visited && queue && depths)
+		max_depth = csr_bfs(csr, queue, depths, visited, action);
+
+	free(visited);
+	free(queue);
+	free(depths);
+	return (max_depth);
+}
@@ -0,0 +1,40 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+#define GRAPH_ARENA_MIN_SLAB 4096
+#define GRAPH_ARENA_DEFAULT_SLAB (1 << 20)
+
+/**
+ * graph_create_arena - Allocates a graph_t structure whose vertices, edges
+ * and contents are bump-allocated in large slabs
+ *
+ * @size_hint: Expected number of bytes taken by the vertices, edges and
+ *   contents of the graph, used to size the slabs. 0 picks a default size.
+ *
+ * Deleting such a graph with graph_delete releases all its memory in one
+ * free per slab, instead of one per vertex, content and edge.
+ *
+ * Return: Pointer to the allocated structure, or NULL on failure
+ */
+graph_t *graph_create_arena(size_t size_hint)
+{
+	graph_t *graph;
+
+	if (size_hint == 0)
+		size_hint = GRAPH_ARENA_DEFAULT_SLAB;
+	else if (size_hint < GRAPH_ARENA_MIN_SLAB)
+		size_hint = GRAPH_ARENA_MIN_SLAB;
+
+	graph = graph_create();
+	if (graph == NULL)
+		return (NULL);
+
+	graph->arena = graph_arena_create(size_hint);
+	if (graph->arena == NULL)
+	{
+		graph_delete(graph);
+		return (NULL);
+	}
+
+	return (graph);
+}
@@ -0,0 +1,135 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * resolve_ends - Looks up the vertices at both ends of every edge
+ *
+ * @graph: Pointer to the graph
+ * @src: Strings identifying the source vertices
+ * @dest: Strings identifying the destination vertices
+ * @ends: Array of 2 * n vertices to fill, source then destination
+ * @n: Number of edges
+ *
+ * Return: 1 if every vertex exists, 0 otherwise
+ */
+static int resolve_ends(const graph_t *graph, const char **src,
+			const char **dest, vertex_t **ends, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		ends[2 * i] = graph_find_vertex(graph, src[i]);
+		ends[2 * i + 1] = graph_find_vertex(graph, dest[i]);
+		if (!ends[2 * i] || !ends[2 * i + 1])
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * reserve_ends - Makes room for a batch of edges at one end, once per
+ * vertex, so that linking the batch cannot fail
+ *
+ * @graph: Pointer to the graph
+ * @ends: Vertices at both ends of every edge, source then destination
+ * @types: Type of each edge, or NULL for UNIDIRECTIONAL edges only
+ * @n: Number of edges in the batch
+ * @counts: Zeroed array of graph->nb_indices entries, left zeroed
+ * @side: 0 to reserve the storage of the edges in the vertices they go
+ *   out of, 1 to reserve their room in the in-edge index of the graph
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int reserve_ends(graph_t *graph, vertex_t **ends, edge_type_t *types,
+			size_t n, size_t *counts, int side)
+{
+	size_t i, *count;
+	int ok = 1;
+
+	/* An end counts if it is on @side, or if its edge goes both ways */
+	for (i = 0; i < 2 * n; i++)
+		if (i % 2 == (size_t)side ||
+		    (types && types[i / 2] == BIDIRECTIONAL))
+			counts[ends[i]->index]++;
+	for (i = 0; i < 2 * n; i++)
+	{
+		count = &counts[ends[i]->index];
+		if (*count == 0)
+			continue;
+		if (ok && side)
+			ok = graph_in_reserve(graph->in_index, ends[i], *count);
+		else if (ok)
+			ok = graph_edge_reserve(graph, ends[i], *count);
+		*count = 0;
+	}
+	return (ok);
+}
+
+/**
+ * link_unique - Links an edge of a batch, unless the graph rejects
+ * duplicate edges and already has it
+ *
+ * @graph: Pointer to the graph
+ * @src: Source vertex, with room reserved for the edge
+ * @dest: Destination vertex
+ *
+ * A skipped edge gives its room in the in-edge index back.
+ */
+static void link_unique(graph_t *graph, vertex_t *src, vertex_t *dest)
+{
+	if (graph->unique_edges && graph_edge_find(src, dest))
+	{
+		if (graph->in_index)
+			graph_in_unreserve(graph->in_index, dest);
+		return;
+	}
+	graph_link_edge(graph, src, dest, 1, graph_edge_alloc(graph, src));
+}
+
+/**
+ * graph_add_edges - Adds a batch of edges to an existing graph
+ *
+ * @graph: Pointer to the graph to add the edges to
+ * @src: Strings identifying the vertices to make the connections from
+ * @dest: Strings identifying the vertices to connect to
+ * @types: Type of each edge, or NULL for UNIDIRECTIONAL edges only
+ * @n: Number of edges in the batch
+ *
+ * Every vertex name is resolved once, and every vertex reserves the
+ * storage of all its edges of the batch at once before any edge is
+ * linked. On failure, no edge is created. If the graph rejects duplicate
+ * edges, the edges it already has are skipped.
+ *
+ * Return: 1 on success, or 0 on failure
+ */
+int graph_add_edges(graph_t *graph, const char **src, const char **dest,
+		    edge_type_t *types, size_t n)
+{
+	vertex_t **ends;
+	size_t *counts, i;
+	int ok;
+
+	if (!graph || !src || !dest)
+		return (0);
+	/* Both ends of every edge must fit in the array below */
+	if (n > (size_t)-1 / 2 / sizeof(void *) - 1)
+		return (0);
+
+	ends = malloc((2 * n + 1) * sizeof(vertex_t *));
+	counts = calloc(graph->nb_indices + 1, sizeof(size_t));
+	ok = ends && counts && resolve_ends(graph, src, dest, ends, n) &&
+		reserve_ends(graph, ends, types, n, counts, 0) &&
+		(!graph->in_index ||
+		 reserve_ends(graph, ends, types, n, counts, 1));
+
+	for (i = 0; ok && i < n; i++)
+	{
+		link_unique(graph, ends[2 * i], ends[2 * i + 1]);
+		if (types && types[i] == BIDIRECTIONAL)
+			link_unique(graph, ends[2 * i + 1], ends[2 * i]);
+	}
+	free(ends);
+	free(counts);
+	return (ok);
+}
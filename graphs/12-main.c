@@ -0,0 +1,60 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+void graph_display(const graph_t *graph);
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    const char *src[] = {
+        "San Francisco", "Boston", "Miami", "Houston", "Chicago",
+        "Las Vegas", "Seattle", "New York", "Seattle", "San Francisco"
+    };
+    const char *dest[] = {
+        "Las Vegas", "New York", "San Francisco", "Seattle", "New York",
+        "New York", "Chicago", "Houston", "Miami", "Boston"
+    };
+    edge_type_t types[] = {
+        BIDIRECTIONAL, UNIDIRECTIONAL, BIDIRECTIONAL, UNIDIRECTIONAL,
+        BIDIRECTIONAL, UNIDIRECTIONAL, UNIDIRECTIONAL, BIDIRECTIONAL,
+        BIDIRECTIONAL, BIDIRECTIONAL
+    };
+    graph_t *graph;
+
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_vertex(graph, "San Francisco") ||
+        !graph_add_vertex(graph, "Seattle") ||
+        !graph_add_vertex(graph, "New York") ||
+        !graph_add_vertex(graph, "Miami") ||
+        !graph_add_vertex(graph, "Chicago") ||
+        !graph_add_vertex(graph, "Houston") ||
+        !graph_add_vertex(graph, "Las Vegas") ||
+        !graph_add_vertex(graph, "Boston"))
+    {
+        fprintf(stderr, "Failed to add vertex\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_edges(graph, src, dest, types, 10))
+    {
+        fprintf(stderr, "Failed to add edges\n");
+        return (EXIT_FAILURE);
+    }
+
+    graph_display(graph);
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,106 @@
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "graphs.h"
+
+/**
+ * ctx_reserve - Grows the buffers of a traversal context
+ *
+ * @ctx: Pointer to the context
+ * @size: Number of vertex indices the buffers must hold
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int ctx_reserve(graph_traversal_ctx_t *ctx, size_t size)
+{
+	void *ptr;
+
+	ptr = realloc(ctx->marks, size * sizeof(unsigned int));
+	if (!ptr)
+		return (0);
+	ctx->marks = ptr;
+	ptr = realloc(ctx->queue, size * sizeof(vertex_t *));
+	if (!ptr)
+		return (0);
+	ctx->queue = ptr;
+	ptr = realloc(ctx->depths, size * sizeof(size_t));
+	if (!ptr)
+		return (0);
+	ctx->depths = ptr;
+	ptr = realloc(ctx->stack, size * sizeof(edge_t *));
+	if (!ptr)
+		return (0);
+	ctx->stack = ptr;
+
+	/* New vertices have never been visited */
+	memset(ctx->marks + ctx->size, 0,
+	       (size - ctx->size) * sizeof(unsigned int));
+	ctx->size = size;
+	return (1);
+}
+
+/**
+ * graph_traversal_ctx_create - Allocates the working memory of traversals,
+ * to be reused across calls to depth_first_traverse_ctx and
+ * breadth_first_traverse_ctx
+ *
+ * @size: Number of vertices the context is sized for. The context grows
+ *   on its own if it is later used on a bigger graph.
+ *
+ * Return: Pointer to the allocated context, or NULL on failure
+ */
+graph_traversal_ctx_t *graph_traversal_ctx_create(size_t size)
+{
+	graph_traversal_ctx_t *ctx;
+
+	ctx = calloc(1, sizeof(graph_traversal_ctx_t));
+	if (!ctx)
+		return (NULL);
+
+	if (!ctx_reserve(ctx, size ? size : 1))
+	{
+		graph_traversal_ctx_delete(ctx);
+		return (NULL);
+	}
+	return (ctx);
+}
+
+/**
+ * graph_traversal_ctx_begin - Prepares a traversal context for a new
+ * traversal, in constant time unless it has to grow
+ *
+ * @ctx: Pointer to the context
+ * @size: Number of vertex indices of the graph about to be traversed
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_traversal_ctx_begin(graph_traversal_ctx_t *ctx, size_t size)
+{
+	if (size > ctx->size && !ctx_reserve(ctx, size))
+		return (0);
+
+	if (ctx->epoch == UINT_MAX)
+	{
+		memset(ctx->marks, 0, ctx->size * sizeof(unsigned int));
+		ctx->epoch = 0;
+	}
+	ctx->epoch++;
+	return (1);
+}
+
+/**
+ * graph_traversal_ctx_delete - Deletes a traversal context
+ *
+ * @ctx: Pointer to the context to delete
+ */
+void graph_traversal_ctx_delete(graph_traversal_ctx_t *ctx)
+{
+	if (!ctx)
+		return;
+
+	free(ctx->marks);
+	free(ctx->queue);
+	free(ctx->depths);
+	free(ctx->stack);
+	free(ctx);
+}
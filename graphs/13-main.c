@@ -0,0 +1,87 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+static size_t visited;
+
+/**
+ * count_action - Counts the vertices visited during a traversal
+ *
+ * @v: Pointer to the visited vertex
+ * @depth: Depth of the vertex in graph from the starting vertex
+ */
+void count_action(const vertex_t *v, size_t depth)
+{
+    (void)v;
+    (void)depth;
+    visited++;
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    graph_traversal_ctx_t *ctx;
+    vertex_t *v;
+    size_t depth;
+
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_vertex(graph, "San Francisco") ||
+        !graph_add_vertex(graph, "Seattle") ||
+        !graph_add_vertex(graph, "New York") ||
+        !graph_add_vertex(graph, "Miami") ||
+        !graph_add_vertex(graph, "Chicago") ||
+        !graph_add_vertex(graph, "Houston") ||
+        !graph_add_vertex(graph, "Las Vegas") ||
+        !graph_add_vertex(graph, "Boston"))
+    {
+        fprintf(stderr, "Failed to add vertex\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_edge(graph, "San Francisco", "Las Vegas", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Boston", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Miami", "San Francisco", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Houston", "Seattle", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Chicago", "New York", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Las Vegas", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Chicago", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "New York", "Houston", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Miami", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "San Francisco", "Boston", BIDIRECTIONAL))
+    {
+        fprintf(stderr, "Failed to add edge\n");
+        return (EXIT_FAILURE);
+    }
+
+    ctx = graph_traversal_ctx_create(graph->nb_vertices);
+    if (!ctx)
+    {
+        fprintf(stderr, "Failed to create traversal context\n");
+        return (EXIT_FAILURE);
+    }
+
+    for (v = graph->vertices; v; v = v->next)
+    {
+        visited = 0;
+        depth = breadth_first_traverse_ctx(graph, ctx, v, &count_action);
+        printf("From %s: %lu vertices reached, depth %lu\n",
+               v->content, visited, depth);
+    }
+
+    graph_traversal_ctx_delete(ctx);
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,190 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+#define UNSEEN ((size_t)-1)
+/* Switching thresholds from Beamer et al., Direction-Optimizing BFS */
+#define DIROPT_ALPHA 14
+#define DIROPT_BETA 24
+
+/**
+ * top_down_step - Expands a BFS level by scanning the out-edges of every
+ * vertex of the frontier
+ *
+ * @csr: Pointer to the snapshot
+ * @depths: Depth of every vertex, UNSEEN if not discovered yet
+ * @queue: Queue of discovered vertices. The frontier is queue[lo, hi).
+ * @lo: Start of the frontier in @queue
+ * @hi: End of the frontier in @queue
+ * @edges_left: Number of out-edges of the undiscovered vertices
+ *
+ * Return: The new end of @queue
+ */
+static size_t top_down_step(const graph_csr_t *csr, size_t *depths,
+			    size_t *queue, size_t lo, size_t hi,
+			    size_t *edges_left)
+{
+	size_t write = hi, u, w, i;
+
+	for (; lo < hi; lo++)
+	{
+		u = queue[lo];
+		for (i = csr->offsets[u]; i < csr->offsets[u + 1]; i++)
+		{
+			w = csr->targets[i];
+			if (depths[w] != UNSEEN)
+				continue;
+			depths[w] = depths[u] + 1;
+			*edges_left -= csr->offsets[w + 1] - csr->offsets[w];
+			queue[write++] = w;
+		}
+	}
+	return (write);
+}
+
+/**
+ * bottom_up_step - Expands a BFS level by having every undiscovered vertex
+ * look for a parent in the frontier among its in-edges
+ *
+ * @csr: Pointer to the snapshot, with its reverse index built
+ * @depths: Depth of every vertex, UNSEEN if not discovered yet
+ * @queue: Queue of discovered vertices
+ * @level: Depth of the frontier
+ * @write: End of @queue
+ * @edges_left: Number of out-edges of the undiscovered vertices
+ *
+ * Return: The new end of @queue
+ */
+static size_t bottom_up_step(const graph_csr_t *csr, size_t *depths,
+			     size_t *queue, size_t level, size_t write,
+			     size_t *edges_left)
+{
+	size_t v, i;
+
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		if (depths[v] != UNSEEN)
+			continue;
+		for (i = csr->in_offsets[v]; i < csr->in_offsets[v + 1]; i++)
+		{
+			if (depths[csr->in_sources[i]] != level)
+				continue;
+			depths[v] = level + 1;
+			*edges_left -= csr->offsets[v + 1] - csr->offsets[v];
+			queue[write++] = v;
+			break;
+		}
+	}
+	return (write);
+}
+
+/**
+ * use_bottom_up - Picks the direction of the next BFS step
+ *
+ * @csr: Pointer to the snapshot
+ * @queue: Queue of discovered vertices. The frontier is queue[lo, hi).
+ * @lo: Start of the frontier in @queue
+ * @hi: End of the frontier in @queue
+ * @prev_size: Size of the previous frontier
+ * @edges_left: Number of out-edges of the undiscovered vertices
+ * @bottom_up: Direction of the previous step
+ *
+ * Return: 1 if the next step should be bottom-up, 0 for top-down
+ */
+static int use_bottom_up(const graph_csr_t *csr, const size_t *queue,
+			 size_t lo, size_t hi, size_t prev_size,
+			 size_t edges_left, int bottom_up)
+{
+	size_t frontier_edges = 0, i;
+
+	if (bottom_up)
+		return (!(hi - lo < prev_size &&
+			  hi - lo < csr->nb_vertices / DIROPT_BETA));
+
+	for (i = lo; i < hi; i++)
+		frontier_edges += csr->offsets[queue[i] + 1] -
+				  csr->offsets[queue[i]];
+	return (frontier_edges > edges_left / DIROPT_ALPHA);
+}
+
+/**
+ * diropt_bfs - Runs a direction-optimizing BFS, level by level
+ *
+ * @csr: Pointer to the snapshot, with its reverse index built
+ * @depths: Depth of every vertex, all UNSEEN
+ * @queue: Queue of vertex indices, able to hold every vertex
+ * @action: Action to perform on each vertex
+ *
+ * Return: The maximum depth reached
+ */
+static size_t diropt_bfs(const graph_csr_t *csr, size_t *depths,
+			 size_t *queue,
+			 void (*action)(const vertex_t *v, size_t depth))
+{
+	size_t lo = 0, hi = 1, prev_size = 0, level = 0, write, i;
+	size_t edges_left = csr->nb_edges;
+	int bottom_up = 0;
+
+	queue[0] = csr->head;
+	depths[csr->head] = 0;
+	edges_left -= csr->offsets[csr->head + 1] - csr->offsets[csr->head];
+
+	while (1)
+	{
+		for (i = lo; i < hi; i++)
+			action(csr->vertices[queue[i]], level);
+
+		bottom_up = use_bottom_up(csr, queue, lo, hi, prev_size,
+					  edges_left, bottom_up);
+		if (bottom_up)
+			write = bottom_up_step(csr, depths, queue, level, hi,
+					       &edges_left);
+		else
+			write = top_down_step(csr, depths, queue, lo, hi,
+					      &edges_left);
+		if (write == hi)
+			return (level);
+		prev_size = hi - lo;
+		lo = hi;
+		hi = write;
+		level++;
+	}
+}
+
+/**
+ * csr_breadth_first_traverse_diropt - Goes through a CSR snapshot of a graph
+ * using a direction-optimizing breadth-first algorithm
+ *
+ * @csr: Pointer to the snapshot to traverse. Its reverse index is built
+ *   if it does not exist yet.
+ * @action: Pointer to the function to be called for each visited vertex
+ *
+ * Large frontiers are expanded bottom-up: every undiscovered vertex looks
+ * for a parent in the frontier and stops at the first one found. Small
+ * frontiers are expanded top-down. Every vertex is reported with the same
+ * depth as breadth_first_traverse, but the vertices of a same level may
+ * be reported in a different order.
+ *
+ * Return: The biggest vertex depth, or 0 on failure
+ */
+size_t csr_breadth_first_traverse_diropt(graph_csr_t *csr,
+					 void (*action)(const vertex_t *v,
+							size_t depth))
+{
+	size_t *depths, *queue, max_depth = 0, i;
+
+	if (!csr || !csr->nb_vertices || !action || !graph_csr_reverse(csr))
+		return (0);
+
+	depths = malloc(csr->nb_vertices * sizeof(size_t));
+	queue = malloc(csr->nb_vertices * sizeof(size_t));
+	if (depths && queue)
+	{
+		for (i = 0; i < csr->nb_vertices; i++)
+			depths[i] = UNSEEN;
+		max_depth = diropt_bfs(csr, depths, queue, action);
+	}
+
+	free(depths);
+	free(queue);
+	return (max_depth);
+}
@@ -0,0 +1,167 @@
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include "graphs.h"
+
+#define BITS_PER_WORD (sizeof(unsigned long) * CHAR_BIT)
+
+/**
+ * pbfs_run - Level loop of a parallel BFS thread
+ *
+ * @arg: Pointer to the state of the thread (csr_pbfs_worker_t)
+ *
+ * Every level goes through three phases separated by barriers: all the
+ * threads expand the frontier, one thread merges the results, then all
+ * the threads copy their local buffers into the next frontier.
+ *
+ * Return: NULL
+ */
+static void *pbfs_run(void *arg)
+{
+	csr_pbfs_worker_t *worker = arg;
+	csr_pbfs_t *pbfs = worker->shared;
+	size_t level = 0;
+
+	/* Wait until every thread is started and the barrier is ready */
+	pthread_mutex_lock(&pbfs->gate);
+	pthread_mutex_unlock(&pbfs->gate);
+
+	while (pbfs->size[level & 1] > 0)
+	{
+		csr_pbfs_expand(worker, level);
+		pthread_barrier_wait(&pbfs->barrier);
+		if (worker->id == 0)
+			csr_pbfs_merge(pbfs, level);
+		pthread_barrier_wait(&pbfs->barrier);
+		if (pbfs->size[(level + 1) & 1] > 0 &&
+		    worker->local_size > 0)
+			memcpy(pbfs->frontier[(level + 1) & 1] + worker->offset,
+			       worker->local, worker->local_size * sizeof(size_t));
+		worker->local_size = 0;
+		pthread_barrier_wait(&pbfs->barrier);
+		level++;
+	}
+	return (NULL);
+}
+
+/**
+ * pbfs_init - Allocates the shared state of a parallel BFS and queues
+ * the starting vertex
+ *
+ * @pbfs: Pointer to the zeroed shared state
+ * @csr: Pointer to the snapshot to traverse
+ * @nb_threads: Number of threads to allocate a state for
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int pbfs_init(csr_pbfs_t *pbfs, const graph_csr_t *csr,
+		     size_t nb_threads)
+{
+	size_t i;
+
+	pbfs->csr = csr;
+	pbfs->workers = calloc(nb_threads, sizeof(csr_pbfs_worker_t));
+	pbfs->visited = calloc(csr->nb_vertices / BITS_PER_WORD + 1,
+			       sizeof(unsigned long));
+	pbfs->frontier[0] = malloc(csr->nb_vertices * sizeof(size_t));
+	pbfs->frontier[1] = malloc(csr->nb_vertices * sizeof(size_t));
+	if (!pbfs->workers || !pbfs->visited || !pbfs->frontier[0] ||
+	    !pbfs->frontier[1])
+		return (0);
+
+	for (i = 0; i < nb_threads; i++)
+	{
+		pbfs->workers[i].shared = pbfs;
+		pbfs->workers[i].id = i;
+	}
+	pbfs->visited[csr->head / BITS_PER_WORD] |=
+		1UL << (csr->head % BITS_PER_WORD);
+	pbfs->frontier[0][0] = csr->head;
+	pbfs->size[0] = 1;
+	return (1);
+}
+
+/**
+ * pbfs_start - Starts the helper threads of a parallel BFS, and sizes the
+ * barrier for the threads that could actually be started
+ *
+ * @pbfs: Pointer to the initialized shared state
+ * @threads: Array of thread handles, one per helper thread
+ * @nb_threads: Number of threads wanted, including the calling thread
+ *
+ * Return: The number of helper threads started
+ */
+static size_t pbfs_start(csr_pbfs_t *pbfs, pthread_t *threads,
+			 size_t nb_threads)
+{
+	size_t started = 0;
+
+	pthread_mutex_lock(&pbfs->gate);
+	while (started + 1 < nb_threads &&
+	       pthread_create(&threads[started], NULL, pbfs_run,
+			      &pbfs->workers[started + 1]) == 0)
+		started++;
+	pbfs->nb_threads = started + 1;
+	pthread_barrier_init(&pbfs->barrier, NULL, started + 1);
+	pthread_mutex_unlock(&pbfs->gate);
+	return (started);
+}
+
+/**
+ * csr_breadth_first_traverse_parallel - Goes through a CSR snapshot of a
+ * graph using a level-synchronous breadth-first algorithm spread over
+ * several threads
+ *
+ * @csr: Pointer to the snapshot to traverse
+ * @nb_threads: Number of threads to use, including the calling thread.
+ *   0 uses one thread per online processor.
+ * @mode: BFS_ACTION_SERIAL to call @action from a single thread, level
+ *   by level, or BFS_ACTION_CONCURRENT to call it from the worker threads
+ * @action: Pointer to the function to be called for each visited vertex
+ *
+ * Every vertex is reported with the same depth as breadth_first_traverse,
+ * but the vertices of a same level may be reported in a different order.
+ *
+ * Return: The biggest vertex depth, or 0 on failure
+ */
+size_t csr_breadth_first_traverse_parallel(const graph_csr_t *csr,
+					   size_t nb_threads,
+					   bfs_action_mode_t mode,
+					   void (*action)(const vertex_t *v,
+							  size_t depth))
+{
+	csr_pbfs_t pbfs;
+	pthread_t *threads;
+	size_t started = 0, i;
+
+	if (!csr || !csr->nb_vertices || !action)
+		return (0);
+	if (nb_threads == 0)
+		nb_threads = sysconf(_SC_NPROCESSORS_ONLN) > 0 ?
+			(size_t)sysconf(_SC_NPROCESSORS_ONLN) : 1;
+
+	memset(&pbfs, 0, sizeof(pbfs));
+	pbfs.action = action;
+	pbfs.mode = mode;
+	threads = malloc(nb_threads * sizeof(pthread_t));
+	if (threads && pbfs_init(&pbfs, csr, nb_threads) &&
+	    pthread_mutex_init(&pbfs.gate, NULL) == 0)
+	{
+		started = pbfs_start(&pbfs, threads, nb_threads);
+		pbfs_run(&pbfs.workers[0]);
+		for (i = 0; i < started; i++)
+			pthread_join(threads[i], NULL);
+		pthread_barrier_destroy(&pbfs.barrier);
+		pthread_mutex_destroy(&pbfs.gate);
+	}
+
+	for (i = 0; pbfs.workers && i < nb_threads; i++)
+		free(pbfs.workers[i].local);
+	free(pbfs.workers);
+	free(pbfs.visited);
+	free(pbfs.frontier[0]);
+	free(pbfs.frontier[1]);
+	free(threads);
+	return (pbfs.error ? 0 : pbfs.max_depth);
+}
@@ -0,0 +1,102 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * graph_bfs_iter_init - Prepares a breadth-first iterator over a graph
+ *
+ * @it: Pointer to the iterator to initialize
+ * @graph: Pointer to the graph to traverse
+ * @ctx: Traversal context to work in, or NULL to let the iterator create
+ *   its own. A context can only be used by one iterator at a time.
+ * @start: Vertex to start from, or NULL to start from the head of the graph
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_bfs_iter_init(graph_bfs_iter_t *it, const graph_t *graph,
+			graph_traversal_ctx_t *ctx, const vertex_t *start)
+{
+	if (!it || !graph || !graph->vertices)
+		return (0);
+
+	it->graph = graph;
+	it->own_ctx = ctx == NULL;
+	it->ctx = ctx ? ctx : graph_traversal_ctx_create(graph->nb_indices);
+	if (!it->ctx || !graph_traversal_ctx_begin(it->ctx, graph->nb_indices))
+	{
+		graph_bfs_iter_end(it);
+		return (0);
+	}
+
+	start = start ? start : graph->vertices;
+	it->ctx->marks[start->index] = it->ctx->epoch;
+	it->ctx->queue[0] = start;
+	it->ctx->depths[0] = 0;
+	it->read = 0;
+	it->write = 1;
+	it->pending = NULL;
+	return (1);
+}
+
+/**
+ * graph_bfs_iter_next - Returns the next vertex of a breadth-first traversal
+ *
+ * @it: Pointer to the iterator
+ * @depth: Pointer where to store the depth of the returned vertex, or NULL
+ *
+ * The edges of a vertex are only followed when the next vertex is asked
+ * for, so a traversal costs nothing past the last vertex it returns.
+ *
+ * Return: Pointer to the next vertex, or NULL when the traversal is over
+ */
+const vertex_t *graph_bfs_iter_next(graph_bfs_iter_t *it, size_t *depth)
+{
+	graph_traversal_ctx_t *ctx = it->ctx;
+	const edge_t *edge;
+	size_t d;
+
+	if (it->pending)
+	{
+		d = ctx->depths[it->read - 1] + 1;
+		GRAPH_FOR_EACH_EDGE(it->pending, edge)
+		{
+			if (ctx->marks[edge->dest->index] == ctx->epoch)
+				continue;
+			ctx->marks[edge->dest->index] = ctx->epoch;
+			ctx->queue[it->write] = edge->dest;
+			ctx->depths[it->write++] = d;
+		}
+		it->pending = NULL;
+	}
+
+	if (it->read == it->write)
+		return (NULL);
+
+	if (depth)
+		*depth = ctx->depths[it->read];
+	it->pending = ctx->queue[it->read++];
+	return (it->pending);
+}
+
+/**
+ * graph_bfs_iter_prune - Prevents the edges of the vertex last returned by
+ * a breadth-first iterator from being followed
+ *
+ * @it: Pointer to the iterator
+ */
+void graph_bfs_iter_prune(graph_bfs_iter_t *it)
+{
+	it->pending = NULL;
+}
+
+/**
+ * graph_bfs_iter_end - Releases the resources of a breadth-first iterator
+ *
+ * @it: Pointer to the iterator
+ */
+void graph_bfs_iter_end(graph_bfs_iter_t *it)
+{
+	if (it->own_ctx)
+		graph_traversal_ctx_delete(it->ctx);
+	it->ctx = NULL;
+	it->own_ctx = 0;
+}
@@ -0,0 +1,112 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * graph_dfs_iter_init - Prepares a depth-first iterator over a graph
+ *
+ * @it: Pointer to the iterator to initialize
+ * @graph: Pointer to the graph to traverse
+ * @ctx: Traversal context to work in, or NULL to let the iterator create
+ *   its own. A context can only be used by one iterator at a time.
+ * @start: Vertex to start from, or NULL to start from the head of the graph
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_dfs_iter_init(graph_dfs_iter_t *it, const graph_t *graph,
+			graph_traversal_ctx_t *ctx, const vertex_t *start)
+{
+	if (!it || !graph || !graph->vertices)
+		return (0);
+
+	it->graph = graph;
+	it->own_ctx = ctx == NULL;
+	it->ctx = ctx ? ctx : graph_traversal_ctx_create(graph->nb_indices);
+	if (!it->ctx || !graph_traversal_ctx_begin(it->ctx, graph->nb_indices))
+	{
+		graph_dfs_iter_end(it);
+		return (0);
+	}
+
+	it->start = start ? start : graph->vertices;
+	it->ctx->marks[it->start->index] = it->ctx->epoch;
+	it->ctx->stack[0] = it->start->edges;
+	it->top = 1;
+	it->can_prune = 0;
+	return (1);
+}
+
+/**
+ * graph_dfs_iter_next - Returns the next vertex of a depth-first traversal
+ *
+ * @it: Pointer to the iterator
+ * @depth: Pointer where to store the depth of the returned vertex, or NULL
+ *
+ * Vertices come in the same order, with the same depths, as with
+ * depth_first_traverse.
+ *
+ * Return: Pointer to the next vertex, or NULL when the traversal is over
+ */
+const vertex_t *graph_dfs_iter_next(graph_dfs_iter_t *it, size_t *depth)
+{
+	graph_traversal_ctx_t *ctx = it->ctx;
+	const edge_t *edge;
+	const vertex_t *v = it->start;
+
+	it->can_prune = 1;
+	if (v)
+	{
+		it->start = NULL;
+		if (depth)
+			*depth = 0;
+		return (v);
+	}
+
+	while (it->top > 0)
+	{
+		edge = ctx->stack[it->top - 1];
+		if (!edge)
+		{
+			it->top--;
+			continue;
+		}
+		ctx->stack[it->top - 1] = edge->next;
+		if (ctx->marks[edge->dest->index] == ctx->epoch)
+			continue;
+
+		ctx->marks[edge->dest->index] = ctx->epoch;
+		if (depth)
+			*depth = it->top;
+		ctx->stack[it->top++] = edge->dest->edges;
+		return (edge->dest);
+	}
+	it->can_prune = 0;
+	return (NULL);
+}
+
+/**
+ * graph_dfs_iter_prune - Skips the part of the traversal below the vertex
+ * last returned by a depth-first iterator
+ *
+ * @it: Pointer to the iterator
+ */
+void graph_dfs_iter_prune(graph_dfs_iter_t *it)
+{
+	if (!it->can_prune)
+		return;
+
+	it->top--;
+	it->can_prune = 0;
+}
+
+/**
+ * graph_dfs_iter_end - Releases the resources of a depth-first iterator
+ *
+ * @it: Pointer to the iterator
+ */
+void graph_dfs_iter_end(graph_dfs_iter_t *it)
+{
+	if (it->own_ctx)
+		graph_traversal_ctx_delete(it->ctx);
+	it->ctx = NULL;
+	it->own_ctx = 0;
+}
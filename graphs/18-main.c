@@ -0,0 +1,77 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "graphs.h"
+
+/**
+ * find_houston - Action stopping the traversal once Houston is reached
+ *
+ * @v: Pointer to the visited vertex
+ * @depth: Depth of the vertex in graph from the starting vertex
+ *
+ * Return: GRAPH_WALK_STOP on Houston, GRAPH_WALK_CONTINUE otherwise
+ */
+graph_walk_t find_houston(const vertex_t *v, size_t depth)
+{
+    printf("%*s[%lu] %s\n", (int)depth * 4, "", v->index, v->content);
+    if (strcmp(v->content, "Houston") == 0)
+        return (GRAPH_WALK_STOP);
+    return (GRAPH_WALK_CONTINUE);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    size_t depth;
+
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_vertex(graph, "San Francisco") ||
+        !graph_add_vertex(graph, "Seattle") ||
+        !graph_add_vertex(graph, "New York") ||
+        !graph_add_vertex(graph, "Miami") ||
+        !graph_add_vertex(graph, "Chicago") ||
+        !graph_add_vertex(graph, "Houston") ||
+        !graph_add_vertex(graph, "Las Vegas") ||
+        !graph_add_vertex(graph, "Boston"))
+    {
+        fprintf(stderr, "Failed to add vertex\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_edge(graph, "San Francisco", "Las Vegas", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Boston", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Miami", "San Francisco", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Houston", "Seattle", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Chicago", "New York", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Las Vegas", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Chicago", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "New York", "Houston", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Miami", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "San Francisco", "Boston", BIDIRECTIONAL))
+    {
+        fprintf(stderr, "Failed to add edge\n");
+        return (EXIT_FAILURE);
+    }
+
+    printf("Breadth First Traversal from Boston, until Houston:\n");
+    depth = breadth_first_traverse_until(graph, NULL,
+                                         graph_find_vertex(graph, "Boston"),
+                                         &find_houston);
+    printf("\nDepth: %lu\n", depth);
+
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,86 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * depth_first_traverse_until - Goes through a graph using the depth-first
+ * algorithm, until the action asks to stop
+ *
+ * @graph: Pointer to the graph to traverse
+ * @ctx: Traversal context to work in, or NULL to use a temporary one
+ * @start: Vertex to start from, or NULL to start from the head of the graph
+ * @action: Pointer to the function to be called for each visited vertex.
+ *   It returns GRAPH_WALK_PRUNE to skip the vertices below the current one,
+ *   or GRAPH_WALK_STOP to end the traversal.
+ *
+ * Return: The biggest depth of the visited vertices, or 0 on failure
+ */
+size_t depth_first_traverse_until(const graph_t *graph,
+				  graph_traversal_ctx_t *ctx,
+				  const vertex_t *start,
+				  graph_walk_t (*action)(const vertex_t *v,
+							 size_t depth))
+{
+	graph_dfs_iter_t it;
+	const vertex_t *v;
+	size_t depth, max_depth = 0;
+	graph_walk_t walk;
+
+	if (!action || !graph_dfs_iter_init(&it, graph, ctx, start))
+		return (0);
+
+	while ((v = graph_dfs_iter_next(&it, &depth)))
+	{
+		if (depth > max_depth)
+			max_depth = depth;
+		walk = action(v, depth);
+		if (walk == GRAPH_WALK_STOP)
+			break;
+		if (walk == GRAPH_WALK_PRUNE)
+			graph_dfs_iter_prune(&it);
+	}
+
+	graph_dfs_iter_end(&it);
+	return (max_depth);
+}
+
+/**
+ * breadth_first_traverse_until - Goes through a graph using the
+ * breadth-first algorithm, until the action asks to stop
+ *
+ * @graph: Pointer to the graph to traverse
+ * @ctx: Traversal context to work in, or NULL to use a temporary one
+ * @start: Vertex to start from, or NULL to start from the head of the graph
+ * @action: Pointer to the function to be called for each visited vertex.
+ *   It returns GRAPH_WALK_PRUNE to leave the edges of the current vertex
+ *   unexplored, or GRAPH_WALK_STOP to end the traversal.
+ *
+ * Return: The biggest depth of the visited vertices, or 0 on failure
+ */
+size_t breadth_first_traverse_until(const graph_t *graph,
+				    graph_traversal_ctx_t *ctx,
+				    const vertex_t *start,
+				    graph_walk_t (*action)(const vertex_t *v,
+							   size_t depth))
+{
+	graph_bfs_iter_t it;
+	const vertex_t *v;
+	size_t depth, max_depth = 0;
+	graph_walk_t walk;
+
+	if (!action || !graph_bfs_iter_init(&it, graph, ctx, start))
+		return (0);
+
+	while ((v = graph_bfs_iter_next(&it, &depth)))
+	{
+		if (depth > max_depth)
+			max_depth = depth;
+		walk = action(v, depth);
+		if (walk == GRAPH_WALK_STOP)
+			break;
+		if (walk == GRAPH_WALK_PRUNE)
+			graph_bfs_iter_prune(&it);
+	}
+
+	graph_bfs_iter_end(&it);
+	return (max_depth);
+}
@@ -0,0 +1,165 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "graphs.h"
+
+
+/**
+ * write_u64 - Writes a 64-bit integer to a file
+ *
+ * @file: Stream to write to
+ * @value: Integer to write
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int write_u64(FILE *file, uint64_t value)
+{
+	return (fwrite(&value, sizeof(value), 1, file) == 1);
+}
+
+/**
+ * save_strings - Writes the content offsets and the string table of a
+ * graph to a binary graph file
+ *
+ * @graph: Pointer to the graph
+ * @file: Stream to write to
+ * @strings_size: Size of the string table
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int save_strings(const graph_t *graph, FILE *file,
+			uint64_t strings_size)
+{
+	static const char zeros[8];
+	const vertex_t *v;
+	uint64_t pos = 0;
+	size_t len;
+	int ok = 1;
+
+	for (v = graph->vertices; ok && v; v = v->next)
+	{
+		ok = write_u64(file, pos);
+		pos += strlen(v->content) + 1;
+	}
+	ok = ok && write_u64(file, pos);
+
+	for (v = graph->vertices; ok && v; v = v->next)
+	{
+		len = strlen(v->content) + 1;
+		ok = fwrite(v->content, 1, len, file) == len;
+	}
+	if (ok && GRAPH_FILE_PAD8(strings_size))
+		ok = fwrite(zeros, 1, GRAPH_FILE_PAD8(strings_size), file) ==
+			GRAPH_FILE_PAD8(strings_size);
+	return (ok);
+}
+
+/**
+ * save_edges - Writes the offsets, targets and weights sections of a
+ * binary graph file
+ *
+ * @graph: Pointer to the graph
+ * @file: Stream to write to
+ * @remap: Array mapping every vertex index to its index in the file, or
+ *   NULL if the graph is compact
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int save_edges(const graph_t *graph, FILE *file, const size_t *remap)
+{
+	const vertex_t *v;
+	const edge_t *e;
+	uint32_t weight;
+	uint64_t pos = 0;
+	int ok = 1;
+
+	for (v = graph->vertices; ok && v; v = v->next)
+	{
+		ok = write_u64(file, pos);
+		pos += v->nb_edges;
+	}
+	ok = ok && write_u64(file, pos);
+
+	for (v = graph->vertices; ok && v; v = v->next)
+		for (e = v->edges; ok && e; e = e->next)
+			ok = write_u64(file, remap ? remap[e->dest->index] :
+				       e->dest->index);
+
+	for (v = graph->vertices; ok && graph->weighted && v; v = v->next)
+		for (e = v->edges; ok && e; e = e->next)
+		{
+			weight = e->weight;
+			ok = fwrite(&weight, sizeof(weight), 1, file) == 1;
+		}
+	return (ok);
+}
+
+/**
+ * fill_header - Fills the header of the binary graph file of a graph
+ *
+ * @graph: Pointer to the graph
+ * @header: Pointer to the header to fill
+ * @remap: Array to fill with the index in the file of every vertex
+ *   index, or NULL if the graph is compact
+ */
+static void fill_header(const graph_t *graph, graph_file_header_t *header,
+			size_t *remap)
+{
+	const vertex_t *v;
+	size_t i = 0;
+
+	memset(header, 0, sizeof(*header));
+	memcpy(header->magic, GRAPH_FILE_MAGIC, sizeof(header->magic));
+	header->version = GRAPH_FILE_VERSION;
+	header->flags = graph->weighted ? GRAPH_FILE_WEIGHTED : 0;
+	header->nb_vertices = graph->nb_vertices;
+	/* The vertex list is in index order, so the head is written first */
+	for (v = graph->vertices; v; v = v->next)
+	{
+		if (remap)
+			remap[v->index] = i++;
+		header->nb_edges += v->nb_edges;
+		header->strings_size += strlen(v->content) + 1;
+	}
+}
+
+/**
+ * graph_save - Writes a graph to a binary graph file, that graph_mmap can
+ * load without rebuilding the graph vertex by vertex
+ *
+ * @graph: Pointer to the graph to save
+ * @path: Path of the file to create or overwrite
+ *
+ * Vertices are written in index order. If vertices were removed, the
+ * indexes are renumbered densely in the file, as by graph_compact.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_save(const graph_t *graph, const char *path)
+{
+	graph_file_header_t header;
+	size_t *remap = NULL;
+	FILE *file;
+	int ok;
+
+	if (!graph || !path)
+		return (0);
+	if (graph->nb_indices != graph->nb_vertices)
+	{
+		remap = malloc(graph->nb_indices * sizeof(size_t));
+		if (!remap)
+			return (0);
+	}
+	fill_header(graph, &header, remap);
+
+	file = fopen(path, "wb");
+	ok = file && fwrite(&header, sizeof(header), 1, file) == 1 &&
+		save_strings(graph, file, header.strings_size) &&
+		save_edges(graph, file, remap);
+	if (file && fclose(file) != 0)
+		ok = 0;
+	if (file && !ok)
+		remove(path);
+	free(remap);
+	return (ok);
+}
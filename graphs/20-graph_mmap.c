@@ -0,0 +1,132 @@
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "graphs.h"
+
+/**
+ * map_vertices - Rebuilds the vertices of a mapped graph, pointing their
+ * content into the string table of the file
+ *
+ * @csr: Pointer to the snapshot, with its offsets set
+ * @names: Content offsets section of the file
+ * @strings: String table of the file
+ * @strings_size: Size of @strings in bytes
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int map_vertices(graph_csr_t *csr, const uint64_t *names,
+			char *strings, size_t strings_size)
+{
+	vertex_t *v;
+	size_t i;
+
+	csr->map_vertices = calloc(csr->nb_vertices + 1, sizeof(vertex_t));
+	csr->vertices = malloc((csr->nb_vertices + 1) * sizeof(vertex_t *));
+	if (!csr->map_vertices || !csr->vertices)
+		return (0);
+
+	for (i = 0; i < csr->nb_vertices; i++)
+	{
+		if (names[i] >= strings_size ||
+		    csr->offsets[i] > csr->offsets[i + 1] ||
+		    csr->offsets[i + 1] > csr->nb_edges)
+			return (0);
+		v = &csr->map_vertices[i];
+		v->index = i;
+		v->content = strings + names[i];
+		v->nb_edges = csr->offsets[i + 1] - csr->offsets[i];
+		v->next = i + 1 < csr->nb_vertices ? v + 1 : NULL;
+		v->prev = i > 0 ? v - 1 : NULL;
+		csr->vertices[i] = v;
+	}
+	return (csr->offsets[0] == 0 && csr->offsets[i] == csr->nb_edges);
+}
+
+/**
+ * csr_from_map - Builds a CSR snapshot on top of a mapped graph file
+ *
+ * @map: Start of the mapping
+ * @size: Size of the mapping in bytes
+ *
+ * Return: Pointer to the snapshot, or NULL on failure
+ */
+static graph_csr_t *csr_from_map(char *map, size_t size)
+{
+	const graph_file_header_t *h = (const graph_file_header_t *)map;
+	graph_csr_t *csr;
+	uint64_t sections[5];
+
+	if (sizeof(size_t) != sizeof(uint64_t) ||
+	    !graph_file_layout(h, size, sections) ||
+	    (h->nb_vertices > 0 && (h->strings_size == 0 ||
+				    map[sections[1] + h->strings_size - 1] != '\0')))
+		return (NULL);
+	csr = calloc(1, sizeof(graph_csr_t));
+	if (!csr)
+		return (NULL);
+
+	csr->map = map;
+	csr->map_size = size;
+	csr->nb_vertices = h->nb_vertices;
+	csr->nb_edges = h->nb_edges;
+	csr->head = h->head;
+	csr->offsets = (size_t *)(map + sections[2]);
+	csr->targets = (size_t *)(map + sections[3]);
+	if (h->flags & GRAPH_FILE_WEIGHTED)
+		csr->weights = (unsigned int *)(map + sections[4]);
+	if (!map_vertices(csr, (const uint64_t *)(map + sections[0]),
+			  map + sections[1], h->strings_size))
+	{
+		csr->map = NULL;
+		free(csr->map_vertices);
+		free(csr->vertices);
+		free(csr);
+		return (NULL);
+	}
+	return (csr);
+}
+
+/**
+ * graph_mmap - Loads a binary graph file written by graph_save, by mapping
+ * it in memory rather than reading it
+ *
+ * @path: Path of the file to load
+ *
+ * The offsets, targets, weights and contents of the returned snapshot
+ * point straight into the read-only mapping, so they are only read from
+ * disk when first accessed. Edge targets are not validated: the file must
+ * have been written by graph_save. An empty graph gives a snapshot
+ * without vertices. Delete the snapshot with graph_csr_delete.
+ *
+ * Return: Pointer to the read-only snapshot, or NULL on failure
+ */
+graph_csr_t *graph_mmap(const char *path)
+{
+	struct stat st;
+	graph_csr_t *csr;
+	void *map;
+	int fd;
+
+	if (!path)
+		return (NULL);
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (NULL);
+	if (fstat(fd, &st) == -1 || st.st_size <= 0)
+	{
+		close(fd);
+		return (NULL);
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return (NULL);
+
+	csr = csr_from_map(map, st.st_size);
+	if (!csr)
+		munmap(map, st.st_size);
+	return (csr);
+}
@@ -0,0 +1,185 @@
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "graphs.h"
+
+#define LOAD_CHUNK (1 << 20)
+#define IS_BLANK(c) ((c) == ' ' || (c) == '\t' || (c) == '\r')
+
+/**
+ * next_token - Cuts the next blank-separated token out of a line
+ *
+ * @cursor: Pointer to the current position in the line, moved past the
+ *   token
+ * @end: End of the line, holding a '\0'
+ *
+ * Return: Pointer to the '\0'-terminated token, or NULL if there is none
+ */
+static char *next_token(char **cursor, char *end)
+{
+	char *p = *cursor, *token;
+
+	while (p < end && IS_BLANK(*p))
+		p++;
+	if (p == end)
+		return (NULL);
+
+	token = p;
+	while (p < end && !IS_BLANK(*p))
+		p++;
+	if (p < end)
+		*p++ = '\0';
+	*cursor = p;
+	return (token);
+}
+
+/**
+ * parse_weight - Parses the weight of an edge
+ *
+ * @str: String to parse, made of decimal digits only
+ * @weight: Pointer where to store the weight
+ *
+ * Return: 1 on success, 0 if @str is not a valid weight
+ */
+static int parse_weight(const char *str, unsigned long *weight)
+{
+	*weight = 0;
+	for (; *str; str++)
+	{
+		if (*str < '0' || *str > '9')
+			return (0);
+		*weight = *weight * 10 + (*str - '0');
+		if (*weight > UINT_MAX)
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * load_line - Adds the edge described by a "src dst [weight]" line to a
+ * graph, creating its vertices as needed
+ *
+ * @graph: Pointer to the graph
+ * @line: Start of the line
+ * @end: End of the line, where a '\0' can be written
+ * @type: Type of the edge
+ *
+ * Return: 1 on success (blank and comment lines included), 0 on failure
+ */
+static int load_line(graph_t *graph, char *line, char *end, edge_type_t type)
+{
+	char *tokens[3];
+	vertex_t *ends[2];
+	unsigned long weight = 1;
+	int i;
+
+	*end = '\0';
+	for (i = 0; i < 3; i++)
+		tokens[i] = next_token(&line, end);
+	if (!tokens[0] || tokens[0][0] == '#' || tokens[0][0] == '%')
+		return (1);
+	if (!tokens[1] || next_token(&line, end) ||
+	    (tokens[2] && !parse_weight(tokens[2], &weight)))
+		return (0);
+
+	for (i = 0; i < 2; i++)
+	{
+		ends[i] = graph_find_vertex(graph, tokens[i]);
+		if (!ends[i])
+			ends[i] = graph_add_vertex(graph, tokens[i]);
+		if (!ends[i])
+			return (0);
+	}
+
+	if (graph_connect(graph, ends[0], ends[1], weight, type) < 0)
+		return (0);
+	graph->weighted |= tokens[2] != NULL;
+	return (1);
+}
+
+/**
+ * load_fd - Streams an edge list from a file descriptor into a graph
+ *
+ * @graph: Pointer to the graph
+ * @fd: File descriptor to read from
+ * @type: Type of the edges
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int load_fd(graph_t *graph, int fd, edge_type_t type)
+{
+	size_t cap = LOAD_CHUNK, len = 0, start;
+	char *buf, *nl, *tmp;
+	ssize_t n = 0;
+	int ok = 1;
+
+	buf = malloc(cap + 1);
+	if (!buf)
+		return (0);
+	while (ok && (n = read(fd, buf + len, cap - len)) > 0)
+	{
+		len += n;
+		start = 0;
+		while (ok && (nl = memchr(buf + start, '\n', len - start)))
+		{
+			ok = load_line(graph, buf + start, nl, type);
+			start = nl - buf + 1;
+		}
+		len -= start;
+		memmove(buf, buf + start, len);
+
+		/* Grow the buffer for lines longer than a chunk */
+		if (ok && len == cap)
+		{
+			tmp = realloc(buf, cap * 2 + 1);
+			ok = tmp != NULL;
+			buf = tmp ? tmp : buf;
+			cap *= 2;
+		}
+	}
+
+	if (ok && n == 0 && len > 0)
+		ok = load_line(graph, buf, buf + len, type);
+	free(buf);
+	return (ok && n == 0);
+}
+
+/**
+ * graph_load_edgelist - Loads a graph from a text file holding one
+ * "src dst [weight]" edge per line
+ *
+ * @path: Path of the file to load
+ * @opts: Loading options, or NULL for UNIDIRECTIONAL edges and a default
+ *   arena size
+ *
+ * The file is read in large chunks and tokenized in place. Vertices are
+ * created the first time their name appears, and interned through the
+ * hash index of the graph. Blank lines and lines starting with '#' or '%'
+ * are ignored. The graph is backed by an arena.
+ *
+ * Return: Pointer to the loaded graph, or NULL on failure
+ */
+graph_t *graph_load_edgelist(const char *path, const graph_load_opts_t *opts)
+{
+	graph_t *graph;
+	int fd, ok;
+
+	if (!path)
+		return (NULL);
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (NULL);
+
+	graph = graph_create_arena(opts ? opts->size_hint : 0);
+	ok = graph && (!opts || !opts->unique || graph_index_edges(graph, 1)) &&
+		load_fd(graph, fd, opts ? opts->type : UNIDIRECTIONAL);
+	close(fd);
+	if (!ok)
+	{
+		graph_delete(graph);
+		return (NULL);
+	}
+	return (graph);
+}
@@ -0,0 +1,53 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+void graph_display(const graph_t *graph);
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    graph_load_opts_t opts;
+    FILE *file;
+
+    file = fopen("graph.txt", "w");
+    if (!file)
+    {
+        fprintf(stderr, "Failed to create edge list\n");
+        return (EXIT_FAILURE);
+    }
+    fprintf(file, "# src dst [weight]\n");
+    fprintf(file, "San_Francisco Las_Vegas 570\n");
+    fprintf(file, "Boston New_York 215\n");
+    fprintf(file, "Miami San_Francisco 2585\n");
+    fprintf(file, "Houston Seattle 1890\n");
+    fprintf(file, "Chicago New_York 790\n");
+    fprintf(file, "Las_Vegas New_York 2230\n");
+    fprintf(file, "Seattle Chicago 1735\n");
+    fprintf(file, "New_York Houston 1420\n");
+    fprintf(file, "Seattle Miami 2730\n");
+    fprintf(file, "San_Francisco Boston 2700\n");
+    fclose(file);
+
+    opts.type = BIDIRECTIONAL;
+    opts.size_hint = 0;
+    opts.unique = 0;
+    graph = graph_load_edgelist("graph.txt", &opts);
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to load graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    graph_display(graph);
+
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,203 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "graphs.h"
+
+#define BUILD_MIN_SLOTS 4096
+
+/**
+ * build_run - Runs one phase of a bulk graph build over all the threads
+ *
+ * @build: Pointer to the shared state
+ * @threads: Array of thread handles, one per helper thread, or NULL
+ * @phase: Function running the phase for one thread
+ *
+ * The shares of the helper threads that cannot be started are run by the
+ * calling thread, so a phase always completes.
+ */
+static void build_run(graph_build_t *build, pthread_t *threads,
+		      void *(*phase)(void *))
+{
+	size_t started = 0, i;
+
+	while (threads && started + 1 < build->nb_threads &&
+	       pthread_create(&threads[started], NULL, phase,
+			      &build->workers[started + 1]) == 0)
+		started++;
+	for (i = started + 1; i < build->nb_threads; i++)
+		phase(&build->workers[i]);
+	phase(&build->workers[0]);
+	for (i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+}
+
+/**
+ * build_vertices - Creates the vertices of a bulk built graph, named after
+ * their index
+ *
+ * @graph: Pointer to the empty graph
+ * @nb_vertices: Number of vertices to create
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int build_vertices(graph_t *graph, size_t nb_vertices)
+{
+	char name[24];
+	size_t i;
+
+	if (!graph_hash_reserve(graph, nb_vertices) ||
+	    !graph_index_reserve(graph, nb_vertices))
+		return (0);
+	for (i = 0; i < nb_vertices; i++)
+	{
+		sprintf(name, "%lu", (unsigned long)i);
+		if (!graph_add_vertex(graph, name))
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * build_init - Picks the number of threads of a bulk graph build, and
+ * allocates its working memory
+ *
+ * @build: Pointer to the shared state, with its graph, pairs and flags set
+ *
+ * The threads are limited so that their histograms never outweigh the
+ * edges they sort.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int build_init(graph_build_t *build)
+{
+	size_t nb_vertices = build->graph->nb_vertices, slots, n, i;
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	graph_build_worker_t *w;
+
+	if (build->nb_pairs > (size_t)-1 / 2 / sizeof(size_t))
+		return (0);
+	slots = build->nb_pairs *
+		(build->flags & GRAPH_BUILD_BIDIRECTIONAL ? 2 : 1);
+	n = cpus > 0 ? (size_t)cpus : 1;
+	if (n > slots / BUILD_MIN_SLOTS)
+		n = slots / BUILD_MIN_SLOTS;
+	if (nb_vertices && n > slots / nb_vertices)
+		n = slots / nb_vertices;
+	build->nb_threads = n ? n : 1;
+
+	build->workers = calloc(build->nb_threads, sizeof(*build->workers));
+	build->offsets = malloc((nb_vertices + 1) * sizeof(size_t));
+	build->targets = malloc((slots ? slots : 1) * sizeof(size_t));
+	if (!build->workers || !build->offsets || !build->targets)
+		return (0);
+	for (i = 0; i < build->nb_threads; i++)
+	{
+		w = &build->workers[i];
+		w->shared = build;
+		w->id = i;
+		w->counts = calloc(nb_vertices + 1, sizeof(size_t));
+		if (!w->counts)
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * build_offsets - Turns the per-thread edge counts of a bulk graph build
+ * into vertex offsets and per-thread scatter cursors, and reserves the
+ * edge storage of every vertex
+ *
+ * @build: Pointer to the shared state, after the counting phase
+ *
+ * The storage is reserved here, by a single thread, so that the linking
+ * threads never allocate from the arena.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int build_offsets(graph_build_t *build)
+{
+	graph_t *graph = build->graph;
+	size_t pos = 0, count, u, t;
+
+	for (u = 0; u < graph->nb_vertices; u++)
+	{
+		build->offsets[u] = pos;
+		for (t = 0; t < build->nb_threads; t++)
+		{
+			count = build->workers[t].counts[u];
+			build->workers[t].counts[u] = pos;
+			pos += count;
+		}
+		if (!graph_edge_reserve(graph, graph->by_index[u],
+					pos - build->offsets[u]))
+			return (0);
+	}
+	build->offsets[u] = pos;
+	return (1);
+}
+
+/**
+ * graph_build_from_edges - Builds a graph at once from an unsorted array
+ * of edges given by the indexes of their ends
+ *
+ * @nb_vertices: Number of vertices of the graph. The vertex of index i is
+ *   named after i, in decimal.
+ * @edges: Array of edge pairs
+ * @nb_edges: Number of pairs in @edges
+ * @flags: GRAPH_BUILD_BIDIRECTIONAL to add every edge in both directions,
+ *   GRAPH_BUILD_DEDUP to keep only one edge per pair of vertices
+ *
+ * The pairs are sorted by source with a parallel counting sort, whose
+ * per-thread histograms give the degree prefix sums, then scattered and
+ * linked by all the threads. The edges of a vertex keep the order of the
+ * pairs, as if they had been added one by one with graph_add_edge. The
+ * graph is backed by an arena.
+ *
+ * Return: Pointer to the built graph, or NULL on failure or if a pair
+ * refers to a missing vertex
+ */
+graph_t *graph_build_from_edges(size_t nb_vertices,
+				const graph_edge_pair_t *edges, size_t nb_edges,
+				int flags)
+{
+	graph_build_t build;
+	pthread_t *threads = NULL;
+	size_t i;
+	int ok;
+
+	if (!edges && nb_edges)
+		return (NULL);
+	memset(&build, 0, sizeof(build));
+	build.pairs = edges;
+	build.nb_pairs = nb_edges;
+	build.flags = flags;
+	build.graph = graph_create_arena(nb_vertices * (sizeof(vertex_t) + 32));
+	ok = build.graph && build_vertices(build.graph, nb_vertices) &&
+		build_init(&build);
+	if (ok)
+	{
+		threads = malloc(build.nb_threads * sizeof(pthread_t));
+		build_run(&build, threads, graph_build_count);
+		ok = !build.error;
+	}
+	ok = ok && build_offsets(&build);
+	if (ok)
+	{
+		build_run(&build, threads, graph_build_scatter);
+		build_run(&build, threads, graph_build_link);
+	}
+
+	for (i = 0; build.workers && i < build.nb_threads; i++)
+		free(build.workers[i].counts);
+	free(build.workers);
+	free(build.offsets);
+	free(build.targets);
+	free(threads);
+	if (!ok)
+	{
+		graph_delete(build.graph);
+		return (NULL);
+	}
+	return (build.graph);
+}
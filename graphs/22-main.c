@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+void graph_display(const graph_t *graph);
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    graph_edge_pair_t edges[] = {
+        {0, 6}, {2, 3}, {4, 0}, {5, 1}, {7, 3},
+        {6, 3}, {1, 7}, {3, 5}, {1, 4}, {0, 2},
+        {3, 2}, {6, 0}
+    };
+
+    graph = graph_build_from_edges(8, edges, sizeof(edges) / sizeof(edges[0]),
+                                   GRAPH_BUILD_BIDIRECTIONAL |
+                                   GRAPH_BUILD_DEDUP);
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to build graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    graph_display(graph);
+
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
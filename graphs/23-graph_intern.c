@@ -0,0 +1,98 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+#define GRAPH_STRINGS_MIN_SIZE 16
+#define GRAPH_STRINGS_SLAB (1 << 16)
+
+/**
+ * strings_reserve - Grows the hash set of a string pool so it stays at
+ * most half full with one more string
+ *
+ * @strings: Pointer to the pool
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int strings_reserve(graph_strings_t *strings)
+{
+	char **table;
+	size_t size, i, j;
+
+	if ((strings->count + 1) * 2 <= strings->size)
+		return (1);
+
+	size = strings->size ? strings->size * 2 : GRAPH_STRINGS_MIN_SIZE;
+	table = calloc(size, sizeof(char *));
+	if (table == NULL)
+		return (0);
+
+	for (i = 0; i < strings->size; i++)
+	{
+		if (strings->table[i] == NULL)
+			continue;
+		j = graph_hash_str(strings->table[i]) & (size - 1);
+		while (table[j])
+			j = (j + 1) & (size - 1);
+		table[j] = strings->table[i];
+	}
+
+	free(strings->table);
+	strings->table = table;
+	strings->size = size;
+	return (1);
+}
+
+/**
+ * graph_intern - Gets the canonical copy of a string in the string pool
+ * of a graph, adding it if needed
+ *
+ * @graph: Pointer to the graph owning the pool
+ * @str: String to intern
+ *
+ * The content of every vertex is interned, so it can be compared by
+ * pointer with the result of this function. Interned strings are never
+ * modified, and are freed by graph_delete only.
+ *
+ * Return: Pointer to the interned string, or NULL on failure
+ */
+const char *graph_intern(graph_t *graph, const char *str)
+{
+	graph_strings_t *strings;
+	size_t mask, i, len;
+	char *copy;
+
+	if (graph == NULL || str == NULL)
+		return (NULL);
+	strings = &graph->strings;
+	if (!strings_reserve(strings))
+		return (NULL);
+
+	mask = strings->size - 1;
+	i = graph_hash_str(str) & mask;
+	while (strings->table[i] && strcmp(strings->table[i], str) != 0)
+		i = (i + 1) & mask;
+	if (strings->table[i])
+		return (strings->table[i]);
+
+	if (strings->arena == NULL)
+		strings->arena = graph_arena_create(GRAPH_STRINGS_SLAB);
+	len = strlen(str) + 1;
+	copy = strings->arena ? graph_arena_alloc(strings->arena, len) : NULL;
+	if (copy == NULL)
+		return (NULL);
+	memcpy(copy, str, len);
+	strings->table[i] = copy;
+	strings->count++;
+	return (copy);
+}
+
+/**
+ * graph_strings_delete - Frees a string pool
+ *
+ * @strings: Pointer to the pool
+ */
+void graph_strings_delete(graph_strings_t *strings)
+{
+	graph_arena_delete(strings->arena);
+	free(strings->table);
+}
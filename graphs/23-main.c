@@ -0,0 +1,47 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    vertex_t *seattle;
+    const char *name, *label;
+
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    seattle = graph_add_vertex(graph, "Seattle");
+    if (!seattle || !graph_add_vertex(graph, "Chicago"))
+    {
+        fprintf(stderr, "Failed to add vertex\n");
+        return (EXIT_FAILURE);
+    }
+
+    name = graph_intern(graph, "Seattle");
+    label = graph_intern(graph, "West coast");
+    if (!name || !label)
+    {
+        fprintf(stderr, "Failed to intern string\n");
+        return (EXIT_FAILURE);
+    }
+
+    printf("Seattle interned: %s\n", name == seattle->content ? "same" : "copy");
+    printf("Label interned twice: %s\n",
+           label == graph_intern(graph, "West coast") ? "same" : "copy");
+    printf("Strings in pool: %lu\n", graph->strings.count);
+
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
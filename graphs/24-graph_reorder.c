@@ -0,0 +1,160 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * cmp_edge - Compares two edges by destination index, then by weight
+ *
+ * @a: Pointer to the first edge pointer
+ * @b: Pointer to the second edge pointer
+ *
+ * Return: A negative, zero or positive value as for qsort
+ */
+static int cmp_edge(const void *a, const void *b)
+{
+	const edge_t *ea = *(edge_t * const *)a;
+	const edge_t *eb = *(edge_t * const *)b;
+
+	if (ea->dest->index != eb->dest->index)
+		return (ea->dest->index < eb->dest->index ? -1 : 1);
+	if (ea->weight != eb->weight)
+		return (ea->weight < eb->weight ? -1 : 1);
+	return (0);
+}
+
+/**
+ * relink_vertices - Renumbers the vertices of a graph densely and relinks
+ * its vertex list in a given order
+ *
+ * @graph: Pointer to the graph
+ * @order: Array of all the vertices, in their new order
+ * @perm: Array of nb_indices entries, where to map every former vertex
+ *   index to its new index
+ * @lists: Zeroed array of nb_vertices + 1 entries, taking over the in-edge
+ *   lists of the graph if it tracks its in-edges, NULL otherwise
+ */
+static void relink_vertices(graph_t *graph, vertex_t **order, size_t *perm,
+			    graph_in_list_t *lists)
+{
+	graph_in_index_t *in = graph->in_index;
+	size_t nb = graph->nb_vertices, i;
+
+	for (i = 0; i < graph->nb_indices; i++)
+		perm[i] = GRAPH_NO_INDEX;
+	for (i = 0; i < nb; i++)
+	{
+		perm[order[i]->index] = i;
+		if (in && order[i]->index < in->nb_lists)
+			lists[i] = in->lists[order[i]->index];
+		order[i]->index = i;
+		order[i]->next = i + 1 < nb ? order[i + 1] : NULL;
+		order[i]->prev = i > 0 ? order[i - 1] : NULL;
+		graph->by_index[i] = order[i];
+	}
+	for (i = nb; i < graph->nb_indices; i++)
+		graph->by_index[i] = NULL;
+	graph->nb_indices = nb;
+	graph->vertices = nb ? order[0] : NULL;
+	graph->vertices_tail = nb ? order[nb - 1] : NULL;
+	if (in)
+	{
+		free(in->lists);
+		in->lists = lists;
+		in->nb_lists = nb + 1;
+	}
+}
+
+/**
+ * sort_edges - Relinks the edges of every vertex of a graph by increasing
+ * destination index, keeping track of the edge before every edge in the
+ * in-edge index
+ *
+ * @graph: Pointer to the graph
+ * @buf: Array of at least as many slots as the biggest vertex has edges
+ */
+static void sort_edges(graph_t *graph, edge_t **buf)
+{
+	vertex_t *v;
+	edge_t *e;
+	size_t n, i;
+
+	for (v = graph->vertices; v; v = v->next)
+	{
+		if (v->nb_edges < 2)
+			continue;
+		n = 0;
+		GRAPH_FOR_EACH_EDGE(v, e)
+			buf[n++] = e;
+		qsort(buf, n, sizeof(edge_t *), cmp_edge);
+		for (i = 0; i < n; i++)
+		{
+			buf[i]->next = i + 1 < n ? buf[i + 1] : NULL;
+			if (graph->in_index)
+				graph_in_find(graph->in_index, buf[i])->prev =
+					i ? buf[i - 1] : NULL;
+		}
+		v->edges = buf[0];
+		v->edges_tail = buf[n - 1];
+	}
+}
+
+/**
+ * graph_reorder - Renumbers the vertices of a graph so that vertices
+ * visited together get close indexes, improving the locality of the
+ * arrays indexed by vertex during traversals
+ *
+ * @graph: Pointer to the graph to reorder
+ * @strategy: Order to renumber the vertices in
+ *
+ * The vertex list is relinked in the new index order, so the head of the
+ * graph becomes the new vertex 0, and the edges of every vertex are
+ * relinked by increasing destination index. The graph ends up compact
+ * (see graph_compact). Vertex pointers stay valid, but CSR snapshots
+ * taken before must be rebuilt.
+ *
+ * Return: Array mapping every former vertex index to its new index, or to
+ * GRAPH_NO_INDEX for removed vertices, to be freed by the caller. NULL on
+ * failure, the graph being then unchanged.
+ */
+size_t *graph_reorder(graph_t *graph, graph_order_t strategy)
+{
+	vertex_t **order, *v;
+	graph_in_list_t *lists = NULL;
+	edge_t **buf;
+	size_t *perm, max = 0;
+	int ok;
+
+	if (graph == NULL)
+		return (NULL);
+	for (v = graph->vertices; v; v = v->next)
+		if (v->nb_edges > max)
+			max = v->nb_edges;
+	order = malloc((graph->nb_vertices + 1) * sizeof(vertex_t *));
+	perm = malloc((graph->nb_indices + 1) * sizeof(size_t));
+	buf = malloc((max + 1) * sizeof(edge_t *));
+	if (graph->in_index)
+		lists = calloc(graph->nb_vertices + 1, sizeof(graph_in_list_t));
+	ok = order && perm && buf && (lists || !graph->in_index);
+
+	if (ok && strategy == GRAPH_ORDER_DEGREE)
+		ok = graph_order_degree(graph, order, 1);
+	else if (ok && (strategy == GRAPH_ORDER_BFS ||
+			strategy == GRAPH_ORDER_RCM))
+		ok = graph_order_bfs(graph, order, strategy == GRAPH_ORDER_RCM);
+	else
+		ok = 0;
+
+	if (ok)
+	{
+		relink_vertices(graph, order, perm, lists);
+		sort_edges(graph, buf);
+	}
+	free(order);
+	free(buf);
+	if (!ok)
+	{
+		free(lists);
+		free(perm);
+		return (NULL);
+	}
+	return (perm);
+}
@@ -0,0 +1,39 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * graph_remove_edge - Removes an edge between two vertices of a graph
+ *
+ * @graph: Pointer to the graph to remove the edge from
+ * @src: String identifying the vertex the connection is made from
+ * @dest: String identifying the vertex the connection is made to
+ * @type: Type of edge (UNIDIRECTIONAL or BIDIRECTIONAL). A BIDIRECTIONAL
+ *   removal requires the edges in both directions to exist.
+ *
+ * Only the first matching edge in each direction is removed, in time
+ * linear in the number of edges of its source vertex. The storage of a
+ * removed edge is reused by the next edge added to its source vertex.
+ *
+ * Return: 1 on success, or 0 on failure (no edge removed)
+ */
+int graph_remove_edge(graph_t *graph, const char *src, const char *dest,
+		      edge_type_t type)
+{
+	vertex_t *v_src, *v_dest;
+
+	if (!graph || !src || !dest)
+		return (0);
+
+	v_src = graph_find_vertex(graph, src);
+	v_dest = graph_find_vertex(graph, dest);
+	if (!v_src || !v_dest)
+		return (0);
+	if (type == BIDIRECTIONAL && !graph_edge_find(v_dest, v_src))
+		return (0);
+
+	if (!graph_unlink_edges(graph, v_src, v_dest, 0))
+		return (0);
+	if (type == BIDIRECTIONAL)
+		graph_unlink_edges(graph, v_dest, v_src, 0);
+	return (1);
+}
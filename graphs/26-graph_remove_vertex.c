@@ -0,0 +1,112 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * remove_out_edges - Removes the edges going out of a vertex
+ *
+ * @graph: Graph the vertex belongs to
+ * @v: Vertex whose edges to remove
+ */
+static void remove_out_edges(graph_t *graph, vertex_t *v)
+{
+	edge_t *e;
+
+	GRAPH_FOR_EACH_EDGE(v, e)
+	{
+		e->dest->nb_in_edges--;
+		if (graph->in_index)
+			graph_in_remove(graph->in_index, e);
+	}
+	graph_edge_storage_delete(graph, v);
+	v->edges = NULL;
+	v->edges_tail = NULL;
+	v->nb_edges = 0;
+}
+
+/**
+ * remove_in_edges - Removes the edges coming into a vertex
+ *
+ * @graph: Graph the vertex belongs to, tracking its in-edges if @v has
+ *   any
+ * @v: Vertex whose in-edges to remove
+ *
+ * Every in-edge is unlinked from its source in constant expected time,
+ * and the in-edges of @v are freed.
+ */
+static void remove_in_edges(graph_t *graph, vertex_t *v)
+{
+	graph_in_list_t *list;
+	graph_in_edge_t in;
+
+	if (!graph->in_index || v->index >= graph->in_index->nb_lists)
+		return;
+	list = &graph->in_index->lists[v->index];
+	while (list->count > 0)
+	{
+		/* The last in-edge is removed without moving the others */
+		in = list->items[list->count - 1];
+		graph_unlink_edge(graph, in.src, in.edge, in.prev);
+	}
+	free(list->items);
+	list->items = NULL;
+	list->size = 0;
+	list->reserved = 0;
+}
+
+/**
+ * unlink_vertex - Unlinks a vertex from the vertex list and the index
+ * table of its graph, in constant time
+ *
+ * @graph: Graph the vertex belongs to
+ * @v: Vertex to unlink
+ */
+static void unlink_vertex(graph_t *graph, vertex_t *v)
+{
+	if (v->prev)
+		v->prev->next = v->next;
+	else
+		graph->vertices = v->next;
+	if (v->next)
+		v->next->prev = v->prev;
+	else
+		graph->vertices_tail = v->prev;
+	graph->by_index[v->index] = NULL;
+}
+
+/**
+ * graph_remove_vertex - Removes a vertex and all its edges from a graph
+ *
+ * @graph: Pointer to the graph to remove the vertex from
+ * @str: String identifying the vertex to remove
+ *
+ * The index of the vertex is left unused, so the other vertices keep
+ * theirs until the graph is compacted (see graph_compact). Its content
+ * stays in the string pool of the graph, and the vertex and its edge
+ * storage are only released with the graph if they belong to its arena.
+ * Removing a vertex with in-edges makes the graph track its in-edges (see
+ * graph_track_in_edges), so that every edge is removed in constant
+ * expected time: the first such removal indexes the whole graph, and the
+ * index is kept until the graph is deleted. A removal then takes time
+ * linear in the degree of the vertex.
+ *
+ * Return: 1 on success, or 0 on failure
+ */
+int graph_remove_vertex(graph_t *graph, const char *str)
+{
+	vertex_t *v;
+
+	if (!graph || !str)
+		return (0);
+	v = graph_find_vertex(graph, str);
+	if (!v || (v->nb_in_edges > 0 && !graph_track_in_edges(graph)))
+		return (0);
+
+	remove_out_edges(graph, v);
+	remove_in_edges(graph, v);
+	unlink_vertex(graph, v);
+	graph_hash_remove(graph, v);
+	graph->nb_vertices--;
+	if (!graph->arena)
+		free(v);
+	return (1);
+}
@@ -0,0 +1,51 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+/**
+ * graph_compact - Renumbers the vertices of a graph densely after
+ * removals, keeping their relative order
+ *
+ * @graph: Pointer to the graph to compact
+ *
+ * Once compacted, nb_indices equals nb_vertices again, so the arrays
+ * indexed by vertex (traversal contexts, pathfinding, CSR snapshots) are
+ * sized on the live vertices only. The in-edges of every vertex follow
+ * it to its new index. CSR snapshots taken before must be rebuilt.
+ *
+ * Return: Array mapping every former vertex index to its new index, or to
+ * GRAPH_NO_INDEX for removed vertices, to be freed by the caller. NULL on
+ * failure, the graph being then unchanged.
+ */
+size_t *graph_compact(graph_t *graph)
+{
+	size_t *perm, i, n = 0;
+	graph_in_index_t *in;
+	vertex_t *v;
+
+	if (graph == NULL)
+		return (NULL);
+	perm = malloc((graph->nb_indices + 1) * sizeof(size_t));
+	if (perm == NULL)
+		return (NULL);
+	in = graph->in_index;
+
+	for (i = 0; i < graph->nb_indices; i++)
+		perm[i] = GRAPH_NO_INDEX;
+	for (v = graph->vertices; v; v = v->next)
+	{
+		perm[v->index] = n;
+		if (in && v->index < in->nb_lists && v->index != n)
+		{
+			/* Indexes only go down, to slots already emptied */
+			in->lists[n] = in->lists[v->index];
+			memset(&in->lists[v->index], 0, sizeof(*in->lists));
+		}
+		v->index = n;
+		graph->by_index[n++] = v;
+	}
+	for (i = n; i < graph->nb_indices; i++)
+		graph->by_index[i] = NULL;
+	graph->nb_indices = n;
+	return (perm);
+}
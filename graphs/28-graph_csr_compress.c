@@ -0,0 +1,163 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+/* Largest encoding of a varint of a size_t */
+#define VARINT_MAX ((sizeof(size_t) * 8 + 6) / 7)
+
+/**
+ * cmp_index - Compares two vertex indexes, for qsort
+ *
+ * @a: Pointer to the first index
+ * @b: Pointer to the second index
+ *
+ * Return: Negative, zero or positive as @a is below, equal or above @b
+ */
+static int cmp_index(const void *a, const void *b)
+{
+	size_t x = *(const size_t *)a, y = *(const size_t *)b;
+
+	return ((x > y) - (x < y));
+}
+
+/**
+ * put_varint - Encodes a number as a varint
+ *
+ * @p: Where to write the varint, with room for VARINT_MAX bytes
+ * @value: Number to encode
+ *
+ * Return: Number of bytes written
+ */
+static size_t put_varint(unsigned char *p, size_t value)
+{
+	size_t n = 0;
+
+	while (value >= 0x80)
+	{
+		p[n++] = (unsigned char)(value | 0x80);
+		value >>= 7;
+	}
+	p[n++] = (unsigned char)value;
+	return (n);
+}
+
+/**
+ * zip_row - Encodes the neighbour list of a vertex at the end of the data
+ * of a compressed snapshot, and records where it starts
+ *
+ * @zip: Pointer to the snapshot, its data holding the previous lists
+ * @csr: Pointer to the CSR snapshot being compressed
+ * @u: Index of the vertex
+ * @dests: Room for the neighbours of the vertex, to sort them
+ * @cap: Pointer to the capacity of the data, grown as needed
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int zip_row(graph_zip_t *zip, const graph_csr_t *csr, size_t u,
+		   size_t *dests, size_t *cap)
+{
+	unsigned char *data;
+	size_t n = csr->offsets[u + 1] - csr->offsets[u], i, gap;
+	size_t need = zip->data_size + n * VARINT_MAX;
+
+	zip->offsets[u] = zip->data_size;
+	zip->vertices[u] = csr->vertices[u];
+	if (need > *cap)
+	{
+		*cap = need > *cap * 2 ? need : *cap * 2;
+		data = realloc(zip->data, *cap);
+		if (!data)
+			return (0);
+		zip->data = data;
+	}
+
+	memcpy(dests, csr->targets + csr->offsets[u], n * sizeof(size_t));
+	qsort(dests, n, sizeof(size_t), cmp_index);
+	for (i = 0; i < n; i++)
+	{
+		if (i > 0)
+			gap = dests[i] - dests[i - 1];
+		else if (dests[0] >= u)
+			gap = (dests[0] - u) * 2;
+		else
+			gap = (u - dests[0]) * 2 - 1;
+		zip->data_size += put_varint(zip->data + zip->data_size, gap);
+	}
+	return (1);
+}
+
+/**
+ * graph_csr_compress - Builds a compressed snapshot of a graph from its
+ * CSR snapshot
+ *
+ * @csr: Pointer to the CSR snapshot, which may be mapped by graph_mmap
+ *
+ * The rows of @csr are read once, in order, so a mapped snapshot is
+ * paged in sequentially. Neighbour lists are sorted by index, which is
+ * the order the compressed traversals follow them in, and edge weights
+ * are dropped. Neighbours close to their source or to each other take a
+ * single byte: renumbering the graph first (see graph_reorder) improves
+ * the compression. The snapshot refers to the vertices of @csr, which
+ * must outlive it.
+ *
+ * Return: Pointer to the compressed snapshot, or NULL on failure
+ */
+graph_zip_t *graph_csr_compress(const graph_csr_t *csr)
+{
+	graph_zip_t *zip;
+	unsigned char *data;
+	size_t *dests, u, max_degree = 1, cap;
+	int ok;
+
+	if (!csr)
+		return (NULL);
+	for (u = 0; u < csr->nb_vertices; u++)
+		if (csr->offsets[u + 1] - csr->offsets[u] > max_degree)
+			max_degree = csr->offsets[u + 1] - csr->offsets[u];
+
+	zip = calloc(1, sizeof(graph_zip_t));
+	dests = malloc(max_degree * sizeof(size_t));
+	ok = zip && dests;
+	if (ok)
+	{
+		zip->nb_vertices = csr->nb_vertices;
+		zip->nb_edges = csr->nb_edges;
+		zip->head = csr->head;
+		zip->offsets = malloc((csr->nb_vertices + 1) * sizeof(size_t));
+		zip->vertices = malloc((csr->nb_vertices + 1) *
+				       sizeof(vertex_t *));
+		cap = csr->nb_edges + 1;
+		zip->data = malloc(cap);
+		ok = zip->offsets && zip->vertices && zip->data;
+	}
+	for (u = 0; ok && u < csr->nb_vertices; u++)
+		ok = zip_row(zip, csr, u, dests, &cap);
+	free(dests);
+	if (!ok)
+	{
+		graph_zip_delete(zip);
+		return (NULL);
+	}
+	zip->offsets[u] = zip->data_size;
+	/* Give back the slack left by the doubling growth */
+	data = realloc(zip->data, zip->data_size + 1);
+	if (data)
+		zip->data = data;
+	return (zip);
+}
+
+/**
+ * graph_zip_delete - Deletes a compressed snapshot
+ *
+ * @zip: Pointer to the snapshot to delete
+ */
+void graph_zip_delete(graph_zip_t *zip)
+{
+	if (!zip)
+		return;
+
+	free(zip->offsets);
+	free(zip->data);
+	free(zip->vertices);
+	free(zip);
+}
@@ -0,0 +1,57 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * graph_zip_neighbors - Starts decoding the neighbour list of a vertex of
+ * a compressed snapshot
+ *
+ * @zip: Pointer to the compressed snapshot
+ * @index: Index of the vertex, below zip->nb_vertices
+ * @it: Pointer to the decoder to initialize
+ *
+ * The decoder holds no memory of its own: it only needs to be dropped
+ * once done with.
+ */
+void graph_zip_neighbors(const graph_zip_t *zip, size_t index,
+			 graph_zip_iter_t *it)
+{
+	it->pos = zip->data + zip->offsets[index];
+	it->end = zip->data + zip->offsets[index + 1];
+	it->src = index;
+	it->last = GRAPH_NO_INDEX;
+}
+
+/**
+ * graph_zip_next - Decodes the next neighbour of a vertex of a compressed
+ * snapshot
+ *
+ * @it: Pointer to the decoder, set up by graph_zip_neighbors
+ * @dest: Pointer where to store the index of the neighbour
+ *
+ * Neighbours come out sorted by index.
+ *
+ * Return: 1 if a neighbour was decoded, 0 at the end of the list
+ */
+int graph_zip_next(graph_zip_iter_t *it, size_t *dest)
+{
+	size_t value = 0;
+	unsigned int shift = 0;
+	unsigned char byte;
+
+	if (it->pos == it->end)
+		return (0);
+	do {
+		byte = *it->pos++;
+		value |= (size_t)(byte & 0x7f) << shift;
+		shift += 7;
+	} while (byte & 0x80);
+
+	if (it->last != GRAPH_NO_INDEX)
+		it->last += value;
+	else if (value & 1)
+		it->last = it->src - (value + 1) / 2;
+	else
+		it->last = it->src + value / 2;
+	*dest = it->last;
+	return (1);
+}
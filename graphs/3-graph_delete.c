@@ -2,40 +2,49 @@
 #include "graphs.h"
 
 /**
- * graph_delete - Deletes a graph completely
+ * delete_vertices - Frees the vertices of a graph one by one, along with
+ * their edges, or only their edge sets if they belong to an arena
  *
- * @graph: Pointer to the graph to delete
+ * @graph: Pointer to the graph
  */
-void graph_delete(graph_t *graph)
+static void delete_vertices(graph_t *graph)
 {
 	vertex_t *v, *v_next;
-	edge_t *e, *e_next;
-
-	if (graph == NULL)
-		return;
 
 	v = graph->vertices;
 	while (v)
 	{
 		v_next = v->next;
 
-		/* Free edges */
-		e = v->edges;
-		while (e)
-		{
-			e_next = e->next;
-			free(e);
-			e = e_next;
-		}
-
-		/* Free vertex content */
-		free(v->content);
+		/* Free the edges that do not fit in the vertex */
+		graph_edge_storage_delete(graph, v);
 
 		/* Free vertex */
-		free(v);
+		if (!graph->arena)
+			free(v);
 
 		v = v_next;
 	}
+}
+
+/**
+ * graph_delete - Deletes a graph completely
+ *
+ * @graph: Pointer to the graph to delete
+ */
+void graph_delete(graph_t *graph)
+{
+	if (graph == NULL)
+		return;
+
+	/* Arena graphs release all their vertices and edges at once */
+	if (!graph->arena || graph->edge_index)
+		delete_vertices(graph);
+	graph_arena_delete(graph->arena);
+	graph_in_index_delete(graph->in_index);
 
+	graph_strings_delete(&graph->strings);
+	free(graph->table);
+	free(graph->by_index);
 	free(graph);
 }
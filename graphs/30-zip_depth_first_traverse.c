@@ -0,0 +1,75 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * zip_dfs - Runs a depth-first traversal over a compressed snapshot, using
+ * an explicit stack of neighbour decoders instead of recursion
+ *
+ * @zip: Pointer to the snapshot to traverse
+ * @visited: Array of visited flags, zeroed
+ * @stack: Neighbour decoder of each stack level, able to hold every vertex
+ * @action: Pointer to the function to be called for each visited vertex
+ *
+ * Return: The biggest vertex depth
+ */
+static size_t zip_dfs(const graph_zip_t *zip, unsigned char *visited,
+		      graph_zip_iter_t *stack,
+		      void (*action)(const vertex_t *v, size_t depth))
+{
+	size_t top = 1, max_depth = 0, w;
+
+	graph_zip_neighbors(zip, zip->head, &stack[0]);
+	visited[zip->head] = 1;
+	action(zip->vertices[zip->head], 0);
+
+	while (top > 0)
+	{
+		if (!graph_zip_next(&stack[top - 1], &w))
+		{
+			top--;
+			continue;
+		}
+		if (visited[w])
+			continue;
+
+		visited[w] = 1;
+		action(zip->vertices[w], top);
+		if (top > max_depth)
+			max_depth = top;
+		graph_zip_neighbors(zip, w, &stack[top]);
+		top++;
+	}
+	return (max_depth);
+}
+
+/**
+ * zip_depth_first_traverse - Goes through a compressed snapshot of a graph
+ * using the depth-first algorithm
+ *
+ * @zip: Pointer to the snapshot to traverse
+ * @action: Pointer to the function to be called for each visited vertex
+ *
+ * The neighbour lists are decoded as they are followed, and never
+ * expanded in memory. Neighbours are followed by increasing index.
+ *
+ * Return: The biggest vertex depth, or 0 on failure
+ */
+size_t zip_depth_first_traverse(const graph_zip_t *zip,
+				void (*action)(const vertex_t *v, size_t depth))
+{
+	unsigned char *visited;
+	graph_zip_iter_t *stack;
+	size_t max_depth = 0;
+
+	if (!zip || !zip->nb_vertices || !action)
+		return (0);
+
+	visited = calloc(zip->nb_vertices, sizeof(unsigned char));
+	stack = malloc(zip->nb_vertices * sizeof(graph_zip_iter_t));
+	if (visited && stack)
+		max_depth = zip_dfs(zip, visited, stack, action);
+
+	free(visited);
+	free(stack);
+	return (max_depth);
+}
@@ -0,0 +1,82 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * zip_bfs - Processes the BFS queue over a compressed snapshot
+ *
+ * @zip: Pointer to the snapshot to traverse
+ * @queue: Queue of vertex indices, able to hold every vertex
+ * @depths: Depth of each queued vertex
+ * @visited: Array of visited flags, zeroed
+ * @action: Action to perform on each vertex
+ *
+ * Return: The maximum depth reached
+ */
+static size_t zip_bfs(const graph_zip_t *zip, size_t *queue, size_t *depths,
+		      unsigned char *visited,
+		      void (*action)(const vertex_t *v, size_t depth))
+{
+	size_t read = 0, write = 1, max_depth = 0, w;
+	graph_zip_iter_t it;
+
+	queue[0] = zip->head;
+	depths[0] = 0;
+	visited[zip->head] = 1;
+
+	while (read < write)
+	{
+		if (depths[read] > max_depth)
+			max_depth = depths[read];
+
+		action(zip->vertices[queue[read]], depths[read]);
+
+		graph_zip_neighbors(zip, queue[read], &it);
+		while (graph_zip_next(&it, &w))
+		{
+			if (!visited[w])
+			{
+				visited[w] = 1;
+				queue[write] = w;
+				depths[write] = depths[read] + 1;
+				write++;
+			}
+		}
+		read++;
+	}
+	return (max_depth);
+}
+
+/**
+ * zip_breadth_first_traverse - Goes through a compressed snapshot of a
+ * graph using the breadth-first algorithm
+ *
+ * @zip: Pointer to the snapshot to traverse
+ * @action: Pointer to the function to be called for each visited vertex
+ *
+ * The neighbour lists are decoded as they are followed, and never
+ * expanded in memory. Neighbours are followed by increasing index.
+ *
+ * Return: The biggest vertex depth, or 0 on failure
+ */
+size_t zip_breadth_first_traverse(const graph_zip_t *zip,
+				  void (*action)(const vertex_t *v,
+						 size_t depth))
+{
+	unsigned char *visited;
+	size_t *queue, *depths;
+	size_t max_depth = 0;
+
+	if (!zip || !zip->nb_vertices || !action)
+		return (0);
+
+	visited = calloc(zip->nb_vertices, sizeof(unsigned char));
+	queue = malloc(zip->nb_vertices * sizeof(size_t));
+	depths = malloc(zip->nb_vertices * sizeof(size_t));
+	if (visited && queue && depths)
+		max_depth = zip_bfs(zip, queue, depths, visited, action);
+
+	free(visited);
+	free(queue);
+	free(depths);
+	return (max_depth);
+}
@@ -0,0 +1,213 @@
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "graphs.h"
+
+#define FILE_BUFFER (1 << 20)
+#define TARGETS_BLOCK 512
+
+/**
+ * file_layout - Reads and checks the header of a binary graph file, and
+ * locates its sections
+ *
+ * @bfs: Pointer to the traversal state, whose header and sections to fill
+ * @fd: File descriptor of the file
+ *
+ * Return: 1 if the file is valid and its graph has vertices, 0 otherwise
+ */
+static int file_layout(graph_file_bfs_t *bfs, int fd)
+{
+	graph_file_header_t *h = &bfs->header;
+	struct stat st;
+
+	if (fstat(fd, &st) == -1 ||
+	    pread(fd, h, sizeof(*h), 0) != (ssize_t)sizeof(*h))
+		return (0);
+	bfs->stats.bytes_read += sizeof(*h);
+	bfs->stats.reads++;
+	return (graph_file_layout(h, st.st_size, bfs->sections) &&
+		h->nb_vertices > 0);
+}
+
+/**
+ * file_visit - Reports a vertex of the frontier of a streamed traversal,
+ * and marks its unvisited neighbours as the next frontier
+ *
+ * @bfs: Pointer to the traversal state
+ * @u: Index of the vertex
+ * @names: Bounds of the content of the vertex in the strings section
+ * @edges: Bounds of the edges of the vertex in the targets section
+ * @level: Depth of the vertex
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int file_visit(graph_file_bfs_t *bfs, size_t u, const uint64_t *names,
+		      const uint64_t *edges, uint32_t level)
+{
+	uint64_t block[TARGETS_BLOCK], i, n, k, len = names[1] - names[0];
+	vertex_t v;
+
+	if (len > bfs->name_size)
+	{
+		free(bfs->name);
+		bfs->name_size = len * 2;
+		bfs->name = malloc(bfs->name_size);
+	}
+	if (!bfs->name || !graph_file_read(&bfs->readers[1], bfs->sections[1] +
+					   names[0], bfs->name, len) ||
+	    bfs->name[len - 1] != '\0')
+		return (0);
+	memset(&v, 0, sizeof(v));
+	v.index = u;
+	v.content = bfs->name;
+	v.nb_edges = edges[1] - edges[0];
+	bfs->action(&v, level);
+	bfs->stats.visited++;
+
+	for (i = edges[0]; i < edges[1]; i += n)
+	{
+		n = edges[1] - i < TARGETS_BLOCK ? edges[1] - i : TARGETS_BLOCK;
+		if (!graph_file_read(&bfs->readers[3], bfs->sections[3] + i * 8,
+				     block, n * 8))
+			return (0);
+		for (k = 0; k < n; k++)
+		{
+			if (block[k] >= bfs->header.nb_vertices)
+				return (0);
+			if (bfs->depths[block[k]] != GRAPH_FILE_UNSEEN)
+				continue;
+			bfs->depths[block[k]] = level + 1;
+			bfs->stats.frontier++;
+		}
+	}
+	return (1);
+}
+
+/**
+ * file_pass - Makes one sequential pass over a binary graph file, visiting
+ * the vertices of a given depth
+ *
+ * @bfs: Pointer to the traversal state
+ * @level: Depth of the vertices to visit
+ *
+ * Only the edges and contents of the visited vertices are read: the rest
+ * of these sections is skipped when it spans more than a buffer.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int file_pass(graph_file_bfs_t *bfs, uint32_t level)
+{
+	const graph_file_header_t *h = &bfs->header;
+	uint64_t names[2], edges[2];
+	size_t u;
+
+	bfs->stats.frontier = 0;
+	if (!graph_file_read(&bfs->readers[0], bfs->sections[0], &names[0], 8) ||
+	    !graph_file_read(&bfs->readers[2], bfs->sections[2], &edges[0], 8))
+		return (0);
+	for (u = 0; u < h->nb_vertices; u++)
+	{
+		if (!graph_file_read(&bfs->readers[0],
+				     bfs->sections[0] + (u + 1) * 8, &names[1], 8) ||
+		    !graph_file_read(&bfs->readers[2],
+				     bfs->sections[2] + (u + 1) * 8, &edges[1], 8) ||
+		    names[1] <= names[0] || names[1] > h->strings_size ||
+		    edges[1] < edges[0] || edges[1] > h->nb_edges)
+			return (0);
+		if (bfs->depths[u] == level &&
+		    !file_visit(bfs, u, names, edges, level))
+			return (0);
+		names[0] = names[1];
+		edges[0] = edges[1];
+	}
+	bfs->stats.passes++;
+	return (1);
+}
+
+/**
+ * file_bfs_init - Sets up the state of a breadth-first traversal streamed
+ * from a binary graph file
+ *
+ * @bfs: Pointer to the zeroed traversal state, with its action set
+ * @fd: File descriptor of the file
+ * @buffer_size: Size of each read buffer, 0 for the default
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int file_bfs_init(graph_file_bfs_t *bfs, int fd, size_t buffer_size)
+{
+	int i, ok;
+
+	if (!file_layout(bfs, fd))
+		return (0);
+	if (buffer_size == 0)
+		buffer_size = FILE_BUFFER;
+	for (i = 0, ok = 1; i < 4; i++)
+		ok = graph_file_reader_init(&bfs->readers[i], fd, buffer_size,
+					    &bfs->stats) && ok;
+	bfs->depths = malloc(bfs->header.nb_vertices * sizeof(uint32_t));
+	if (!ok || !bfs->depths)
+		return (0);
+
+	/* GRAPH_FILE_UNSEEN has all its bits set */
+	memset(bfs->depths, 0xff, bfs->header.nb_vertices * sizeof(uint32_t));
+	bfs->depths[bfs->header.head] = 0;
+	bfs->stats.frontier = 1;
+	return (1);
+}
+
+/**
+ * file_breadth_first_traverse - Goes through a graph using the
+ * breadth-first algorithm, streaming it from a binary graph file written
+ * by graph_save instead of loading it
+ *
+ * @path: Path of the file
+ * @opts: Traversal options, or NULL for the defaults
+ * @action: Pointer to the function to be called for each visited vertex.
+ *   The vertex it gets only lives for the duration of the call, and has no
+ *   edges: only its index, content and number of edges are set.
+ *
+ * Only the depth of every vertex is kept in memory, on 32 bits. Each
+ * depth level takes one sequential pass over the file, visiting the
+ * vertices of that level by increasing index. The traversal starts from
+ * the head of the graph.
+ *
+ * Return: The biggest vertex depth, or 0 on failure
+ */
+size_t file_breadth_first_traverse(const char *path,
+				   const graph_file_bfs_opts_t *opts,
+				   void (*action)(const vertex_t *v,
+						  size_t depth))
+{
+	graph_file_bfs_t bfs;
+	uint32_t level = 0;
+	int fd, ok, i;
+
+	if (!path || !action)
+		return (0);
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (0);
+
+	memset(&bfs, 0, sizeof(bfs));
+	bfs.action = action;
+	ok = file_bfs_init(&bfs, fd, opts ? opts->buffer_size : 0);
+	while (ok && bfs.stats.frontier > 0 && level < GRAPH_FILE_UNSEEN - 1)
+	{
+		ok = file_pass(&bfs, level);
+		if (ok && opts && opts->progress)
+			opts->progress(&bfs.stats);
+		level += ok && bfs.stats.frontier > 0;
+	}
+
+	if (opts && opts->stats)
+		*opts->stats = bfs.stats;
+	for (i = 0; i < 4; i++)
+		graph_file_reader_end(&bfs.readers[i]);
+	free(bfs.depths);
+	free(bfs.name);
+	close(fd);
+	return (ok ? level : 0);
+}
@@ -0,0 +1,136 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * graph_in_index_delete - Frees an in-edge index
+ *
+ * @in: Pointer to the in-edge index, or NULL
+ */
+void graph_in_index_delete(graph_in_index_t *in)
+{
+	size_t i;
+
+	if (in == NULL)
+		return;
+	for (i = 0; i < in->nb_lists; i++)
+		free(in->lists[i].items);
+	free(in->lists);
+	free(in->slots);
+	free(in);
+}
+
+/**
+ * in_index_create - Allocates the in-edge index of a graph, sized for its
+ * edges
+ *
+ * @graph: Pointer to the graph
+ *
+ * Return: Pointer to the empty index, or NULL on failure
+ */
+static graph_in_index_t *in_index_create(const graph_t *graph)
+{
+	graph_in_index_t *in;
+	graph_in_list_t *list;
+	vertex_t *v;
+	size_t nb_edges = 0;
+	int ok;
+
+	in = calloc(1, sizeof(graph_in_index_t));
+	if (in == NULL)
+		return (NULL);
+	in->nb_lists = graph->nb_indices + 1;
+	in->lists = calloc(in->nb_lists, sizeof(graph_in_list_t));
+	ok = in->lists != NULL;
+	for (v = graph->vertices; ok && v; v = v->next)
+	{
+		list = &in->lists[v->index];
+		list->size = v->nb_in_edges + 1;
+		list->items = malloc(list->size * sizeof(graph_in_edge_t));
+		ok = list->items != NULL;
+		if (ok)
+			list->items[0].edge = NULL;
+		nb_edges += v->nb_edges;
+	}
+	if (!ok || !graph_in_table_reserve(in, nb_edges))
+	{
+		graph_in_index_delete(in);
+		return (NULL);
+	}
+	return (in);
+}
+
+/**
+ * graph_track_in_edges - Starts maintaining the in-edges of every vertex
+ * of a graph, so that its predecessors can be listed
+ *
+ * @graph: Pointer to the graph
+ *
+ * The in-edges of the existing edges are indexed right away, in an index
+ * kept aside from the vertices and edges. From then on, adding and
+ * removing edges keep the index up to date, in constant expected time.
+ * Walk the in-edges of a vertex with GRAPH_FOR_EACH_IN_EDGE.
+ *
+ * Return: 1 on success, or 0 on failure
+ */
+int graph_track_in_edges(graph_t *graph)
+{
+	graph_in_index_t *in;
+	vertex_t *v;
+	edge_t *e, *prev;
+
+	if (!graph)
+		return (0);
+	if (graph->in_index)
+		return (1);
+
+	in = in_index_create(graph);
+	if (in == NULL)
+		return (0);
+	for (v = graph->vertices; v; v = v->next)
+	{
+		prev = NULL;
+		GRAPH_FOR_EACH_EDGE(v, e)
+		{
+			graph_in_add(in, v, e, prev);
+			prev = e;
+		}
+	}
+	graph->in_index = in;
+	return (1);
+}
+
+/**
+ * graph_in_edges - Gives the edges coming into a vertex
+ *
+ * @graph: Pointer to the graph, tracking its in-edges (see
+ *   graph_track_in_edges)
+ * @v: Pointer to the vertex
+ *
+ * The array is only valid until the edges of the graph change.
+ *
+ * Return: Array of the in-edges of @v, in no particular order, ended by
+ * an entry whose edge is NULL, or NULL if @v has no in-edge or the graph
+ * does not track them
+ */
+const graph_in_edge_t *graph_in_edges(const graph_t *graph,
+				      const vertex_t *v)
+{
+	if (!graph || !v || !graph->in_index ||
+	    v->index >= graph->in_index->nb_lists)
+		return (NULL);
+	return (graph->in_index->lists[v->index].items);
+}
+
+/**
+ * graph_in_degree - Gives the number of edges coming into a vertex
+ *
+ * @v: Pointer to the vertex
+ *
+ * The count is maintained whether or not the graph tracks its in-edges.
+ *
+ * Return: The number of edges pointing to @v
+ */
+size_t graph_in_degree(const vertex_t *v)
+{
+	return (v ? v->nb_in_edges : 0);
+}
@@ -0,0 +1,81 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    vertex_t *v;
+    const graph_in_edge_t *in;
+
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_vertex(graph, "San Francisco") ||
+        !graph_add_vertex(graph, "Seattle") ||
+        !graph_add_vertex(graph, "New York") ||
+        !graph_add_vertex(graph, "Miami") ||
+        !graph_add_vertex(graph, "Chicago") ||
+        !graph_add_vertex(graph, "Houston") ||
+        !graph_add_vertex(graph, "Las Vegas") ||
+        !graph_add_vertex(graph, "Boston"))
+    {
+        fprintf(stderr, "Failed to add vertex\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_edge(graph, "San Francisco", "Las Vegas", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Boston", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Miami", "San Francisco", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Houston", "Seattle", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Chicago", "New York", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Las Vegas", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Chicago", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "New York", "Houston", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Miami", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "San Francisco", "Boston", BIDIRECTIONAL))
+    {
+        fprintf(stderr, "Failed to add edge\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_track_in_edges(graph))
+    {
+        fprintf(stderr, "Failed to track in-edges\n");
+        return (EXIT_FAILURE);
+    }
+
+    for (v = graph->vertices; v; v = v->next)
+    {
+        printf("[%lu] %s (%lu in):", v->index, v->content,
+               graph_in_degree(v));
+        GRAPH_FOR_EACH_IN_EDGE(graph, v, in)
+            printf(" %s", in->src->content);
+        printf("\n");
+    }
+
+    graph_remove_vertex(graph, "Seattle");
+    printf("\nAfter removing Seattle:\n");
+    for (v = graph->vertices; v; v = v->next)
+    {
+        printf("[%lu] %s (%lu in):", v->index, v->content,
+               graph_in_degree(v));
+        GRAPH_FOR_EACH_IN_EDGE(graph, v, in)
+            printf(" %s", in->src->content);
+        printf("\n");
+    }
+
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
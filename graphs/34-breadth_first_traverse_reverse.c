@@ -0,0 +1,85 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * process_bfs_reverse - Processes the BFS queue, following the edges
+ * backward
+ *
+ * @graph: Pointer to the graph, tracking its in-edges
+ * @start: Vertex to start the traversal from
+ * @ctx: Traversal context, begun for the traversed graph
+ * @action: Action to perform on each vertex
+ *
+ * Return: The maximum depth reached
+ */
+static size_t process_bfs_reverse(const graph_t *graph,
+				  const vertex_t *start,
+				  graph_traversal_ctx_t *ctx,
+				  void (*action)(const vertex_t *v,
+						 size_t depth))
+{
+	const vertex_t **queue = ctx->queue;
+	size_t *depths = ctx->depths;
+	size_t read = 0, write = 1, max_depth = 0;
+	const graph_in_edge_t *in;
+
+	queue[0] = start;
+	depths[0] = 0;
+	ctx->marks[start->index] = ctx->epoch;
+
+	while (read < write)
+	{
+		if (depths[read] > max_depth)
+			max_depth = depths[read];
+
+		action(queue[read], depths[read]);
+
+		GRAPH_FOR_EACH_IN_EDGE(graph, queue[read], in)
+		{
+			if (ctx->marks[in->src->index] != ctx->epoch)
+			{
+				ctx->marks[in->src->index] = ctx->epoch;
+				queue[write] = in->src;
+				depths[write] = depths[read] + 1;
+				write++;
+			}
+		}
+		read++;
+	}
+	return (max_depth);
+}
+
+/**
+ * breadth_first_traverse_reverse - Goes through the vertices a vertex can
+ * be reached from, using the breadth-first algorithm on reversed edges
+ *
+ * @graph: Pointer to the graph to traverse, tracking its in-edges (see
+ *   graph_track_in_edges)
+ * @ctx: Traversal context to work in, or NULL to use a temporary one
+ * @start: Vertex to start from, or NULL to start from the head of the graph
+ * @action: Pointer to the function to be called for each visited vertex.
+ *   The depth of a vertex is the length of its shortest path to @start.
+ *
+ * Return: The biggest vertex depth, or 0 on failure
+ */
+size_t breadth_first_traverse_reverse(const graph_t *graph,
+				      graph_traversal_ctx_t *ctx,
+				      const vertex_t *start,
+				      void (*action)(const vertex_t *v,
+						     size_t depth))
+{
+	graph_traversal_ctx_t *own = NULL;
+	size_t max_depth = 0;
+
+	if (!graph || !graph->vertices || !graph->in_index || !action)
+		return (0);
+
+	if (!ctx)
+		ctx = own = graph_traversal_ctx_create(graph->nb_indices);
+	if (ctx && graph_traversal_ctx_begin(ctx, graph->nb_indices))
+		max_depth = process_bfs_reverse(graph, start ? start :
+						graph->vertices, ctx, action);
+
+	graph_traversal_ctx_delete(own);
+	return (max_depth);
+}
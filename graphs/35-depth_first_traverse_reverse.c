@@ -0,0 +1,86 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * dfs_reverse - Runs a depth-first traversal following the edges backward,
+ * using an explicit stack
+ *
+ * @graph: Pointer to the graph, tracking its in-edges
+ * @start: Vertex to start the traversal from
+ * @ctx: Traversal context, begun for the traversed graph
+ * @action: Pointer to the function to be called for each visited vertex
+ *
+ * The stack holds the vertices of the current path in the queue of @ctx,
+ * and the position of the next in-edge to follow from each of them in its
+ * depths.
+ *
+ * Return: The biggest vertex depth
+ */
+static size_t dfs_reverse(const graph_t *graph, const vertex_t *start,
+			  graph_traversal_ctx_t *ctx,
+			  void (*action)(const vertex_t *v, size_t depth))
+{
+	const vertex_t **path = ctx->queue, *src;
+	const graph_in_edge_t *in;
+	size_t *next = ctx->depths, top = 1, max_depth = 0;
+
+	ctx->marks[start->index] = ctx->epoch;
+	action(start, 0);
+	path[0] = start;
+	next[0] = 0;
+
+	while (top > 0)
+	{
+		in = graph_in_edges(graph, path[top - 1]);
+		if (!in || !in[next[top - 1]].edge)
+		{
+			top--;
+			continue;
+		}
+		src = in[next[top - 1]++].src;
+		if (ctx->marks[src->index] == ctx->epoch)
+			continue;
+
+		ctx->marks[src->index] = ctx->epoch;
+		action(src, top);
+		if (top > max_depth)
+			max_depth = top;
+		path[top] = src;
+		next[top++] = 0;
+	}
+	return (max_depth);
+}
+
+/**
+ * depth_first_traverse_reverse - Goes through the vertices a vertex can be
+ * reached from, using the depth-first algorithm on reversed edges
+ *
+ * @graph: Pointer to the graph to traverse, tracking its in-edges (see
+ *   graph_track_in_edges)
+ * @ctx: Traversal context to work in, or NULL to use a temporary one
+ * @start: Vertex to start from, or NULL to start from the head of the graph
+ * @action: Pointer to the function to be called for each visited vertex
+ *
+ * Return: The biggest vertex depth, or 0 on failure
+ */
+size_t depth_first_traverse_reverse(const graph_t *graph,
+				    graph_traversal_ctx_t *ctx,
+				    const vertex_t *start,
+				    void (*action)(const vertex_t *v,
+						   size_t depth))
+{
+	graph_traversal_ctx_t *own = NULL;
+	size_t max_depth = 0;
+
+	if (!graph || !graph->vertices || !graph->in_index || !action)
+		return (0);
+
+	if (!ctx)
+		ctx = own = graph_traversal_ctx_create(graph->nb_indices);
+	if (ctx && graph_traversal_ctx_begin(ctx, graph->nb_indices))
+		max_depth = dfs_reverse(graph, start ? start : graph->vertices,
+					ctx, action);
+
+	graph_traversal_ctx_delete(own);
+	return (max_depth);
+}
@@ -0,0 +1,70 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * graph_index_edges - Makes the vertices of a graph with many edges keep
+ * a hash set of their edges, so that looking an edge up takes constant
+ * expected time whatever the degree
+ *
+ * @graph: Pointer to the graph
+ * @reject_duplicates: If set, adding an edge the graph already has is
+ *   rejected from then on (see graph_add_edge)
+ *
+ * The sets are kept up to date as edges are added and removed. They cost
+ * two to four pointers per edge of the vertices that have one.
+ *
+ * Return: 1 on success, or 0 on failure
+ */
+int graph_index_edges(graph_t *graph, int reject_duplicates)
+{
+	vertex_t *v;
+	int ok = 1;
+
+	if (!graph)
+		return (0);
+
+	for (v = graph->vertices; ok && !graph->edge_index && v; v = v->next)
+		if (v->nb_edges >= GRAPH_EDGE_SET_MIN)
+			ok = graph_edge_set_build(v);
+	if (!ok)
+	{
+		/* Sets that would not be maintained must not be looked up */
+		for (v = graph->vertices; v; v = v->next)
+		{
+			free(v->edge_set);
+			v->edge_set = NULL;
+			v->edge_set_size = 0;
+		}
+		return (0);
+	}
+	graph->edge_index = 1;
+	graph->unique_edges = reject_duplicates != 0;
+	return (1);
+}
+
+/**
+ * graph_has_edge - Checks whether a graph has an edge between two vertices
+ *
+ * @graph: Pointer to the graph
+ * @src: String identifying the vertex the connection is made from
+ * @dest: String identifying the vertex the connection is made to
+ *
+ * This scans the edges of @src, unless the graph indexes its edges (see
+ * graph_index_edges).
+ *
+ * Return: 1 if an edge goes from @src to @dest, 0 otherwise
+ */
+int graph_has_edge(const graph_t *graph, const char *src, const char *dest)
+{
+	vertex_t *v_src, *v_dest;
+
+	if (!graph || !src || !dest)
+		return (0);
+
+	v_src = graph_find_vertex(graph, src);
+	v_dest = graph_find_vertex(graph, dest);
+	if (!v_src || !v_dest)
+		return (0);
+
+	return (graph_edge_find(v_src, v_dest) != NULL);
+}
@@ -0,0 +1,76 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    const char *pairs[][2] = {
+        {"Seattle", "Chicago"}, {"Chicago", "Seattle"},
+        {"Boston", "New York"}, {"New York", "Boston"}
+    };
+    size_t i;
+
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_vertex(graph, "San Francisco") ||
+        !graph_add_vertex(graph, "Seattle") ||
+        !graph_add_vertex(graph, "New York") ||
+        !graph_add_vertex(graph, "Miami") ||
+        !graph_add_vertex(graph, "Chicago") ||
+        !graph_add_vertex(graph, "Houston") ||
+        !graph_add_vertex(graph, "Las Vegas") ||
+        !graph_add_vertex(graph, "Boston"))
+    {
+        fprintf(stderr, "Failed to add vertex\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_edge(graph, "San Francisco", "Las Vegas", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Boston", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Miami", "San Francisco", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Houston", "Seattle", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Chicago", "New York", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Las Vegas", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Chicago", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "New York", "Houston", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Miami", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "San Francisco", "Boston", BIDIRECTIONAL))
+    {
+        fprintf(stderr, "Failed to add edge\n");
+        return (EXIT_FAILURE);
+    }
+
+    for (i = 0; i < 4; i++)
+        printf("%s -> %s: %d\n", pairs[i][0], pairs[i][1],
+               graph_has_edge(graph, pairs[i][0], pairs[i][1]));
+
+    if (!graph_index_edges(graph, 1))
+    {
+        fprintf(stderr, "Failed to index edges\n");
+        return (EXIT_FAILURE);
+    }
+    printf("Adding Seattle -> Chicago again: %d\n",
+           graph_add_edge(graph, "Seattle", "Chicago", UNIDIRECTIONAL));
+    printf("Adding Boston <-> New York: %d\n",
+           graph_add_edge(graph, "Boston", "New York", BIDIRECTIONAL));
+    printf("New York -> Boston: %d\n",
+           graph_has_edge(graph, "New York", "Boston"));
+    printf("Adding Boston <-> New York again: %d\n",
+           graph_add_edge(graph, "Boston", "New York", BIDIRECTIONAL));
+
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
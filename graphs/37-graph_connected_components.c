@@ -0,0 +1,119 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "graphs.h"
+
+#define CC_MIN_VERTICES 4096
+
+/**
+ * cc_run - Runs one phase of a connected components search over all the
+ * threads
+ *
+ * @cc: Pointer to the shared state
+ * @threads: Array of thread handles, one per helper thread, or NULL
+ * @phase: Function running the phase, shared by all the threads
+ *
+ * The threads take chunks of vertices from a shared cursor, so the phase
+ * completes even if no helper thread can be started.
+ */
+static void cc_run(graph_cc_t *cc, pthread_t *threads, void *(*phase)(void *))
+{
+	size_t started = 0, i;
+
+	cc->cursor = 0;
+	while (threads && started + 1 < cc->nb_threads &&
+	       pthread_create(&threads[started], NULL, phase, cc) == 0)
+		started++;
+	phase(cc);
+	for (i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+}
+
+/**
+ * cc_number - Turns the flattened union-find forest into dense component
+ * identifiers, in place, and counts the vertices of every component
+ *
+ * @graph: Pointer to the graph
+ * @labels: Root of every vertex index, replaced by its component
+ * @sizes: Where to count the vertices of every component, or NULL
+ *
+ * Components are numbered by their smallest vertex index. Every root is
+ * numbered before the vertices pointing at it, whose root then already
+ * holds the identifier to copy.
+ *
+ * Return: The number of components
+ */
+static size_t cc_number(const graph_t *graph, size_t *labels, size_t *sizes)
+{
+	size_t nb_components = 0, i;
+
+	for (i = 0; i < graph->nb_indices; i++)
+	{
+		if (!graph->by_index[i])
+		{
+			labels[i] = GRAPH_NO_INDEX;
+			continue;
+		}
+		if (labels[i] == i)
+		{
+			if (sizes)
+				sizes[nb_components] = 0;
+			labels[i] = nb_components++;
+		}
+		else
+			labels[i] = labels[labels[i]];
+		if (sizes)
+			sizes[labels[i]]++;
+	}
+	return (nb_components);
+}
+
+/**
+ * graph_connected_components - Finds the connected components of a graph,
+ * with a lock-free union-find spread over several threads
+ *
+ * @graph: Pointer to the graph
+ * @labels: Array of graph->nb_indices entries, where to store the
+ *   component of every vertex index. Removed vertices get GRAPH_NO_INDEX.
+ * @sizes: Array of graph->nb_indices entries, where to store the number
+ *   of vertices of every component, or NULL
+ * @nb_threads: Number of threads to use, including the calling thread.
+ *   0 uses one thread per online processor.
+ *
+ * Edges are followed whatever their direction, so the components are the
+ * weakly connected ones. Components are numbered from 0, in the order of
+ * their smallest vertex index, so the result does not depend on the
+ * number of threads. @labels doubles as the union-find forest, so no
+ * other memory is needed.
+ *
+ * Return: The number of components, or 0 on failure or if the graph has
+ * no vertex
+ */
+size_t graph_connected_components(const graph_t *graph, size_t *labels,
+				  size_t *sizes, size_t nb_threads)
+{
+	graph_cc_t cc;
+	pthread_t *threads;
+	size_t i;
+
+	if (!graph || !labels)
+		return (0);
+	if (nb_threads == 0)
+		nb_threads = sysconf(_SC_NPROCESSORS_ONLN) > 0 ?
+			(size_t)sysconf(_SC_NPROCESSORS_ONLN) : 1;
+	if (nb_threads > graph->nb_indices / CC_MIN_VERTICES)
+		nb_threads = graph->nb_indices / CC_MIN_VERTICES;
+
+	memset(&cc, 0, sizeof(cc));
+	cc.graph = graph;
+	cc.parent = labels;
+	cc.nb_threads = nb_threads ? nb_threads : 1;
+	for (i = 0; i < graph->nb_indices; i++)
+		labels[i] = i;
+	threads = cc.nb_threads > 1 ?
+		malloc((cc.nb_threads - 1) * sizeof(pthread_t)) : NULL;
+	cc_run(&cc, threads, graph_cc_link);
+	cc_run(&cc, threads, graph_cc_flatten);
+	free(threads);
+	return (cc_number(graph, labels, sizes));
+}
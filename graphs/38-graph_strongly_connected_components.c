@@ -0,0 +1,174 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+/**
+ * scc_enter - Starts visiting a vertex in a strongly connected components
+ * search, pushing its frame on the explicit call stack
+ *
+ * @scc: Pointer to the search state
+ * @depth: Number of frames on the call stack
+ * @v: Vertex to visit
+ *
+ * Return: The new number of frames
+ */
+static size_t scc_enter(graph_scc_t *scc, size_t depth, const vertex_t *v)
+{
+	graph_scc_frame_t *f = &scc->frames[depth];
+
+	f->v = v;
+	f->e = v->edges;
+	f->root = 1;
+	scc->rindex[v->index] = scc->index++;
+	return (depth + 1);
+}
+
+/**
+ * scc_close - Ends the visit of a vertex whose edges were all followed
+ *
+ * @scc: Pointer to the search state
+ * @f: Frame of the vertex
+ *
+ * A vertex that reached nothing visited before it roots a component: the
+ * vertices pushed since it was entered are popped and get the component
+ * number @scc->c, counting down from the top of the index space, so they
+ * never compare below a vertex still being visited. Any other vertex is
+ * left on the stack of its root.
+ */
+static void scc_close(graph_scc_t *scc, const graph_scc_frame_t *f)
+{
+	size_t v = f->v->index, *rindex = scc->rindex;
+
+	if (!f->root)
+	{
+		scc->stack[scc->top++] = v;
+		return;
+	}
+	scc->index--;
+	while (scc->top > 0 && rindex[v] <= rindex[scc->stack[scc->top - 1]])
+	{
+		rindex[scc->stack[--scc->top]] = scc->c;
+		scc->index--;
+	}
+	rindex[v] = scc->c--;
+}
+
+/**
+ * scc_visit - Runs the depth-first search of the strongly connected
+ * components from an unvisited vertex, with an explicit call stack
+ *
+ * @scc: Pointer to the search state
+ * @start: Vertex to start from
+ *
+ * An edge is only stepped over once its destination is visited, so the
+ * frame of a vertex gets back to the same edge when a visit it started
+ * returns, and then takes the lowest index reached into account.
+ */
+static void scc_visit(graph_scc_t *scc, const vertex_t *start)
+{
+	graph_scc_frame_t *f;
+	size_t depth = scc_enter(scc, 0, start), w;
+
+	while (depth > 0)
+	{
+		f = &scc->frames[depth - 1];
+		if (!f->e)
+		{
+			scc_close(scc, f);
+			depth--;
+			continue;
+		}
+		w = f->e->dest->index;
+		if (scc->rindex[w] == 0)
+		{
+			depth = scc_enter(scc, depth, f->e->dest);
+			continue;
+		}
+		if (scc->rindex[w] < scc->rindex[f->v->index])
+		{
+			scc->rindex[f->v->index] = scc->rindex[w];
+			f->root = 0;
+		}
+		f->e = f->e->next;
+	}
+}
+
+/**
+ * scc_number - Turns the component numbers left by the search into
+ * identifiers counted from 0, in place, and counts the vertices of every
+ * component
+ *
+ * @scc: Pointer to the search state, once every vertex is visited
+ * @sizes: Where to count the vertices of every component, or NULL
+ *
+ * Return: The number of components
+ */
+static size_t scc_number(graph_scc_t *scc, size_t *sizes)
+{
+	const graph_t *graph = scc->graph;
+	size_t nb_components = graph->nb_indices - 1 - scc->c, i;
+
+	if (sizes)
+		memset(sizes, 0, nb_components * sizeof(size_t));
+	for (i = 0; i < graph->nb_indices; i++)
+	{
+		if (!graph->by_index[i])
+		{
+			scc->rindex[i] = GRAPH_NO_INDEX;
+			continue;
+		}
+		scc->rindex[i] -= scc->c + 1;
+		if (sizes)
+			sizes[scc->rindex[i]]++;
+	}
+	return (nb_components);
+}
+
+/**
+ * graph_strongly_connected_components - Finds the strongly connected
+ * components of a graph, without recursion
+ *
+ * @graph: Pointer to the graph
+ * @labels: Array of graph->nb_indices entries, where to store the
+ *   component of every vertex index. Removed vertices get GRAPH_NO_INDEX.
+ * @sizes: Array of graph->nb_indices entries, where to store the number
+ *   of vertices of every component, or NULL
+ *
+ * This is Pearce's variant of Tarjan's algorithm: @labels holds the visit
+ * index of every vertex, lowered to the smallest one it reaches, and then
+ * its component, so only a stack of vertices and the explicit call stack
+ * are needed besides it. The search runs in linear time, and its depth is
+ * only bounded by memory. Components are numbered from 0 in topological
+ * order: every edge between two components goes to the one with the
+ * bigger number.
+ *
+ * Return: The number of components, or 0 on failure or if the graph has
+ * no vertex
+ */
+size_t graph_strongly_connected_components(const graph_t *graph,
+					   size_t *labels, size_t *sizes)
+{
+	graph_scc_t scc;
+	size_t i, nb_components = 0;
+
+	if (!graph || !labels || !graph->nb_vertices)
+		return (0);
+	memset(&scc, 0, sizeof(scc));
+	scc.graph = graph;
+	scc.rindex = labels;
+	scc.index = 1;
+	scc.c = graph->nb_indices - 1;
+	scc.stack = malloc(graph->nb_vertices * sizeof(size_t));
+	scc.frames = malloc(graph->nb_vertices * sizeof(graph_scc_frame_t));
+	if (scc.stack && scc.frames)
+	{
+		memset(labels, 0, graph->nb_indices * sizeof(size_t));
+		for (i = 0; i < graph->nb_indices; i++)
+			if (graph->by_index[i] && labels[i] == 0)
+				scc_visit(&scc, graph->by_index[i]);
+		nb_components = scc_number(&scc, sizes);
+	}
+	free(scc.stack);
+	free(scc.frames);
+	return (nb_components);
+}
@@ -0,0 +1,71 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    size_t *labels, *sizes, nb_components, i;
+    vertex_t *v;
+
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_vertex(graph, "San Francisco") ||
+        !graph_add_vertex(graph, "Seattle") ||
+        !graph_add_vertex(graph, "New York") ||
+        !graph_add_vertex(graph, "Miami") ||
+        !graph_add_vertex(graph, "Chicago") ||
+        !graph_add_vertex(graph, "Houston") ||
+        !graph_add_vertex(graph, "Las Vegas") ||
+        !graph_add_vertex(graph, "Boston"))
+    {
+        fprintf(stderr, "Failed to add vertex\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_edge(graph, "San Francisco", "Las Vegas", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Las Vegas", "Seattle", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "San Francisco", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Chicago", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Chicago", "New York", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "New York", "Boston", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Miami", "Houston", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Houston", "Chicago", UNIDIRECTIONAL))
+    {
+        fprintf(stderr, "Failed to add edge\n");
+        return (EXIT_FAILURE);
+    }
+
+    labels = malloc(graph->nb_indices * sizeof(size_t));
+    sizes = malloc(graph->nb_indices * sizeof(size_t));
+    if (!labels || !sizes)
+    {
+        fprintf(stderr, "Failed to allocate labels\n");
+        return (EXIT_FAILURE);
+    }
+    nb_components = graph_strongly_connected_components(graph, labels,
+                                                        sizes);
+    printf("Number of components: %lu\n", nb_components);
+    for (v = graph->vertices; v; v = v->next)
+        printf("[%lu] %s: component %lu\n", v->index, v->content,
+               labels[v->index]);
+    for (i = 0; i < nb_components; i++)
+        printf("Component %lu: %lu vertices\n", i, sizes[i]);
+
+    free(labels);
+    free(sizes);
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,159 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "graphs.h"
+
+/**
+ * cond_vertices - Creates the vertices of a condensation, named after
+ * their component
+ *
+ * @dag: Pointer to the empty condensation
+ * @nb_components: Number of components
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int cond_vertices(graph_t *dag, size_t nb_components)
+{
+	char name[24];
+	size_t i;
+
+	if (!graph_hash_reserve(dag, nb_components) ||
+	    !graph_index_reserve(dag, nb_components))
+		return (0);
+	for (i = 0; i < nb_components; i++)
+	{
+		sprintf(name, "%lu", (unsigned long)i);
+		if (!graph_add_vertex(dag, name))
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * cond_group - Sorts the vertex indexes of a graph by component, with a
+ * counting sort
+ *
+ * @graph: Pointer to the graph
+ * @labels: Component of every vertex index
+ * @offsets: Number of vertices of every component, turned into the end of
+ *   every component in @order
+ * @nb_components: Number of components
+ * @order: Where to store the vertex indexes, grouped by component
+ */
+static void cond_group(const graph_t *graph, const size_t *labels,
+		       size_t *offsets, size_t nb_components, size_t *order)
+{
+	size_t pos = 0, count, i;
+
+	for (i = 0; i < nb_components; i++)
+	{
+		count = offsets[i];
+		offsets[i] = pos;
+		pos += count;
+	}
+	for (i = 0; i < graph->nb_indices; i++)
+		if (graph->by_index[i])
+			order[offsets[labels[i]]++] = i;
+}
+
+/**
+ * cond_edges - Adds the edges of a condensation, one per pair of
+ * components linked by at least one edge of the graph
+ *
+ * @dag: Pointer to the condensation, its vertices created
+ * @graph: Pointer to the graph
+ * @labels: Component of every vertex index
+ * @offsets: End of every component in @order
+ * @order: Vertex indexes of the graph, grouped by component
+ *
+ * The components are processed one at a time, so a destination component
+ * is a duplicate when its mark already holds the current component plus
+ * one.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int cond_edges(graph_t *dag, const graph_t *graph,
+		      const size_t *labels, const size_t *offsets,
+		      const size_t *order)
+{
+	size_t *marks, k, i, l;
+	const edge_t *e;
+
+	marks = calloc(dag->nb_vertices, sizeof(size_t));
+	if (!marks)
+		return (0);
+	for (k = 0, i = 0; k < dag->nb_vertices; k++)
+	{
+		for (; i < offsets[k]; i++)
+		{
+			GRAPH_FOR_EACH_EDGE(graph->by_index[order[i]], e)
+			{
+				l = labels[e->dest->index];
+				if (l == k || marks[l] == k + 1)
+					continue;
+				marks[l] = k + 1;
+				if (graph_connect(dag, dag->by_index[k],
+						  dag->by_index[l], 1,
+						  UNIDIRECTIONAL) < 0)
+				{
+					free(marks);
+					return (0);
+				}
+			}
+		}
+	}
+	free(marks);
+	return (1);
+}
+
+/**
+ * graph_condensation - Builds the condensation of a graph: the directed
+ * acyclic graph of its strongly connected components
+ *
+ * @graph: Pointer to the graph
+ * @labels: Array of graph->nb_indices entries, where to store the
+ *   component of every vertex index (see
+ *   graph_strongly_connected_components), or NULL
+ *
+ * The vertex of index k of the condensation stands for component k, and
+ * is named after k, in decimal. It has one edge, of weight 1, to every
+ * other component some vertex of component k has an edge to, so the
+ * vertex indexes are in topological order. The condensation is built in
+ * linear time, with a few arrays of one word per vertex, and is backed by
+ * an arena.
+ *
+ * Return: Pointer to the condensation, or NULL on failure
+ */
+graph_t *graph_condensation(const graph_t *graph, size_t *labels)
+{
+	graph_t *dag = NULL;
+	size_t *own = NULL, *offsets, *order, nb;
+	int ok;
+
+	if (!graph)
+		return (NULL);
+	if (!labels)
+		labels = own = malloc((graph->nb_indices + 1) * sizeof(size_t));
+	offsets = malloc((graph->nb_indices + 1) * sizeof(size_t));
+	order = malloc((graph->nb_vertices + 1) * sizeof(size_t));
+	ok = labels && offsets && order;
+	nb = ok ? graph_strongly_connected_components(graph, labels,
+						      offsets) : 0;
+	ok = ok && (nb > 0 || graph->nb_vertices == 0);
+	if (ok)
+		dag = graph_create_arena(nb * (sizeof(vertex_t) + 32));
+	ok = ok && dag && cond_vertices(dag, nb);
+	if (ok)
+	{
+		cond_group(graph, labels, offsets, nb, order);
+		ok = cond_edges(dag, graph, labels, offsets, order);
+	}
+	free(own);
+	free(offsets);
+	free(order);
+	if (!ok)
+	{
+		graph_delete(dag);
+		return (NULL);
+	}
+	return (dag);
+}
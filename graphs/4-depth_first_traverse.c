@@ -2,61 +2,89 @@
 #include "graphs.h"
 
 /**
- * dfs_recursive - Helper function for Depth First Traversal
+ * dfs_iterative - Helper function for Depth First Traversal, using an
+ * explicit stack so that the depth of the graph is not bounded by the
+ * size of the call stack
  *
- * @v: Current vertex being visited
- * @visited: Array of visited statuses
+ * @start: Vertex to start the traversal from
+ * @ctx: Traversal context, begun for the traversed graph
  * @action: Pointer to the function to be called for each visited vertex
- * @depth: Current depth
- * @max_depth: Pointer to the max depth variable
+ *
+ * Return: The biggest vertex depth
  */
-static void dfs_recursive(const vertex_t *v, int *visited,
-			  void (*action)(const vertex_t *v, size_t depth),
-			  size_t depth, size_t *max_depth)
+static size_t dfs_iterative(const vertex_t *start, graph_traversal_ctx_t *ctx,
+			    void (*action)(const vertex_t *v, size_t depth))
 {
-	edge_t *edge;
-
-	visited[v->index] = 1;
-	action(v, depth);
+	const edge_t *edge, **stack = ctx->stack;
+	size_t top = 1, max_depth = 0;
 
-	if (depth > *max_depth)
-		*max_depth = depth;
+	ctx->marks[start->index] = ctx->epoch;
+	action(start, 0);
+	stack[0] = start->edges;
 
-	edge = v->edges;
-	while (edge)
+	while (top > 0)
 	{
-		if (!visited[edge->dest->index])
+		edge = stack[top - 1];
+		if (!edge)
 		{
-			dfs_recursive(edge->dest, visited, action,
-				      depth + 1, max_depth);
+			top--;
+			continue;
 		}
-		edge = edge->next;
+		stack[top - 1] = edge->next;
+		if (ctx->marks[edge->dest->index] == ctx->epoch)
+			continue;
+
+		ctx->marks[edge->dest->index] = ctx->epoch;
+		action(edge->dest, top);
+		if (top > max_depth)
+			max_depth = top;
+		stack[top++] = edge->dest->edges;
 	}
+	return (max_depth);
 }
 
 /**
- * depth_first_traverse - Goes through a graph using the depth-first algorithm
+ * depth_first_traverse_ctx - Goes through a graph using the depth-first
+ * algorithm, with working memory reused from previous traversals
  *
  * @graph: Pointer to the graph to traverse
+ * @ctx: Traversal context to work in, or NULL to use a temporary one
+ * @start: Vertex to start from, or NULL to start from the head of the graph
  * @action: Pointer to the function to be called for each visited vertex
  *
  * Return: The biggest vertex depth, or 0 on failure
  */
-size_t depth_first_traverse(const graph_t *graph,
-			    void (*action)(const vertex_t *v, size_t depth))
+size_t depth_first_traverse_ctx(const graph_t *graph,
+				graph_traversal_ctx_t *ctx,
+				const vertex_t *start,
+				void (*action)(const vertex_t *v, size_t depth))
 {
-	int *visited;
+	graph_traversal_ctx_t *own = NULL;
 	size_t max_depth = 0;
 
 	if (!graph || !graph->vertices || !action)
 		return (0);
 
-	visited = calloc(graph->nb_vertices, sizeof(int));
-	if (!visited)
-		return (0);
-
-	dfs_recursive(graph->vertices, visited, action, 0, &max_depth);
+	if (!ctx)
+		ctx = own = graph_traversal_ctx_create(graph->nb_indices);
+	if (ctx && graph_traversal_ctx_begin(ctx, graph->nb_indices))
+		max_depth = dfs_iterative(start ? start : graph->vertices, ctx,
+					  action);
 
-	free(visited);
+	graph_traversal_ctx_delete(own);
 	return (max_depth);
 }
+
+/**
+ * depth_first_traverse - Goes through a graph using the depth-first algorithm
+ *
+ * @graph: Pointer to the graph to traverse
+ * @action: Pointer to the function to be called for each visited vertex
+ *
+ * Return: The biggest vertex depth, or 0 on failure
+ */
+size_t depth_first_traverse(const graph_t *graph,
+			    void (*action)(const vertex_t *v, size_t depth))
+{
+	return (depth_first_traverse_ctx(graph, NULL, NULL, action));
+}
@@ -0,0 +1,214 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "graphs.h"
+
+/* Smallest number of edges and vertices worth a thread of its own */
+#define PR_MIN_WORK 65536
+
+/**
+ * pr_run - Iteration loop of a PageRank thread
+ *
+ * @arg: Pointer to the state of the thread (csr_pr_worker_t)
+ *
+ * Every iteration goes through two phases separated by barriers: all the
+ * threads pull the scores of their share, then one thread merges the
+ * results.
+ *
+ * Return: NULL
+ */
+static void *pr_run(void *arg)
+{
+	csr_pr_worker_t *worker = arg;
+	csr_pr_t *pr = worker->shared;
+
+	/* Wait until every thread is started and the barrier is ready */
+	pthread_mutex_lock(&pr->gate);
+	pthread_mutex_unlock(&pr->gate);
+
+	while (!pr->done)
+	{
+		csr_pr_pull(worker);
+		pthread_barrier_wait(&pr->barrier);
+		if (worker->id == 0)
+			csr_pr_merge(pr);
+		pthread_barrier_wait(&pr->barrier);
+	}
+	return (NULL);
+}
+
+/**
+ * pr_threads - Picks the number of threads of a PageRank computation
+ *
+ * @csr: Pointer to the snapshot
+ * @wanted: Number of threads asked for, 0 for one per online processor
+ *
+ * The threads are limited so that each one gets enough edges and vertices
+ * to make up for its synchronization.
+ *
+ * Return: The number of threads to use
+ */
+static size_t pr_threads(const graph_csr_t *csr, size_t wanted)
+{
+	size_t work = csr->nb_edges + csr->nb_vertices;
+
+	if (wanted == 0)
+		wanted = sysconf(_SC_NPROCESSORS_ONLN) > 0 ?
+			(size_t)sysconf(_SC_NPROCESSORS_ONLN) : 1;
+	if (wanted > work / PR_MIN_WORK)
+		wanted = work / PR_MIN_WORK;
+	return (wanted ? wanted : 1);
+}
+
+/**
+ * pr_init - Allocates the state of a PageRank computation and spreads the
+ * scores evenly over the vertices
+ *
+ * @pr: Pointer to the zeroed shared state, with its snapshot, options and
+ *   number of threads
+ * @scores: Score of every vertex index, to initialize
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int pr_init(csr_pr_t *pr, double *scores)
+{
+	const graph_csr_t *csr = pr->csr;
+	size_t n = csr->nb_vertices, v, degree;
+	double dangling = 0;
+
+	pr->scores = scores;
+	pr->workers = calloc(pr->nb_threads, sizeof(csr_pr_worker_t));
+	pr->contrib[0] = calloc(n + 1, sizeof(double));
+	pr->contrib[1] = calloc(n + 1, sizeof(double));
+	pr->inv_degree = calloc(n + 1, sizeof(double));
+	if (!pr->workers || !pr->contrib[0] || !pr->contrib[1] ||
+	    !pr->inv_degree)
+		return (0);
+
+	for (v = 0; v < pr->nb_threads; v++)
+	{
+		pr->workers[v].shared = pr;
+		pr->workers[v].id = v;
+	}
+	for (v = 0; v < n; v++)
+		pr->nb_live += csr->vertices[v] != NULL;
+	if (pr->nb_live == 0)
+		return (0);
+	for (v = 0; v < n; v++)
+	{
+		scores[v] = csr->vertices[v] ? 1.0 / pr->nb_live : 0;
+		degree = csr->offsets[v + 1] - csr->offsets[v];
+		if (degree > 0)
+			pr->inv_degree[v] = 1.0 / degree;
+		else
+			dangling += scores[v];
+		pr->contrib[0][v] = scores[v] * pr->inv_degree[v];
+	}
+	pr->base = (1 - pr->opts.damping + pr->opts.damping * dangling) /
+		pr->nb_live;
+	pr->sum = csr_pr_kernel(pr->opts.vectorize, &pr->stats.lanes);
+	return (1);
+}
+
+/**
+ * pr_start - Starts the helper threads of a PageRank computation, then
+ * splits the vertices between the threads that could actually be
+ * started, by number of in-edges, and sizes the barrier for them
+ *
+ * @pr: Pointer to the initialized shared state
+ * @threads: Array of thread handles, one per helper thread
+ *
+ * The helper threads wait on the gate, so their shares are set before
+ * they read them.
+ *
+ * Return: The number of helper threads started
+ */
+static size_t pr_start(csr_pr_t *pr, pthread_t *threads)
+{
+	const graph_csr_t *csr = pr->csr;
+	size_t work = csr->nb_edges + csr->nb_vertices, started = 0, t, v = 0;
+
+	pthread_mutex_lock(&pr->gate);
+	while (started + 1 < pr->nb_threads &&
+	       pthread_create(&threads[started], NULL, pr_run,
+			      &pr->workers[started + 1]) == 0)
+		started++;
+	pr->nb_threads = started + 1;
+	for (t = 0; t < pr->nb_threads; t++)
+	{
+		pr->workers[t].lo = v;
+		while (v < csr->nb_vertices && csr->in_offsets[v + 1] + v + 1 <=
+		       work / pr->nb_threads * (t + 1))
+			v++;
+		if (t + 1 == pr->nb_threads)
+			v = csr->nb_vertices;
+		pr->workers[t].hi = v;
+	}
+	pthread_barrier_init(&pr->barrier, NULL, pr->nb_threads);
+	pthread_mutex_unlock(&pr->gate);
+	return (started);
+}
+
+/**
+ * csr_pagerank - Computes the PageRank of every vertex of a CSR snapshot
+ * of a graph, spread over several threads
+ *
+ * @csr: Pointer to the snapshot. Its reverse index is built if missing
+ *   (see graph_csr_reverse).
+ * @opts: Options of the computation, or NULL for the defaults
+ *   (GRAPH_PAGERANK_DAMPING, GRAPH_PAGERANK_ITERS, no tolerance, one
+ *   thread per online processor)
+ * @scores: Array of csr->nb_vertices entries, where to store the score of
+ *   every vertex index. Unused indexes get 0.
+ *
+ * Every iteration pulls, for each vertex, the scores of its in-edges from
+ * the contiguous reverse index, each source giving an even share of its
+ * score to every one of its out-edges. The scores of the vertices without
+ * out-edges are spread over all the vertices, so the scores always sum to
+ * 1. Edge weights are ignored. The in-edges of a vertex can be summed
+ * with vector gathers (see graph_pagerank_opts_t).
+ *
+ * Return: The number of iterations run, or 0 on failure
+ */
+size_t csr_pagerank(graph_csr_t *csr, const graph_pagerank_opts_t *opts,
+		    double *scores)
+{
+	csr_pr_t pr;
+	pthread_t *threads;
+	size_t started, i;
+
+	memset(&pr, 0, sizeof(pr));
+	pr.opts.damping = GRAPH_PAGERANK_DAMPING;
+	if (opts)
+		pr.opts = *opts;
+	if (!csr || !scores || !(pr.opts.damping >= 0 &&
+				 pr.opts.damping <= 1) ||
+	    !graph_csr_reverse(csr))
+		return (0);
+	if (pr.opts.max_iters == 0)
+		pr.opts.max_iters = GRAPH_PAGERANK_ITERS;
+	pr.csr = csr;
+	pr.nb_threads = pr_threads(csr, pr.opts.nb_threads);
+
+	threads = malloc(pr.nb_threads * sizeof(pthread_t));
+	if (threads && pr_init(&pr, scores) &&
+	    pthread_mutex_init(&pr.gate, NULL) == 0)
+	{
+		clock_gettime(CLOCK_MONOTONIC, &pr.tick);
+		started = pr_start(&pr, threads);
+		pr.stats.nb_threads = pr.nb_threads;
+		pr_run(&pr.workers[0]);
+		for (i = 0; i < started; i++)
+			pthread_join(threads[i], NULL);
+		pthread_barrier_destroy(&pr.barrier);
+		pthread_mutex_destroy(&pr.gate);
+	}
+	if (opts && opts->stats)
+		*opts->stats = pr.stats;
+	free(pr.workers);
+	free(pr.contrib[0]);
+	free(pr.contrib[1]);
+	free(pr.inv_degree);
+	free(threads);
+	return (pr.stats.iterations);
+}
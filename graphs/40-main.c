@@ -0,0 +1,93 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+/**
+ * progress - Prints the progress of a PageRank computation
+ *
+ * @stats: Statistics of the computation so far
+ */
+void progress(const graph_pagerank_stats_t *stats)
+{
+    if (stats->iterations % 20 == 0)
+        printf("Iteration %lu: delta %.2e\n", stats->iterations,
+               stats->delta);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    graph_csr_t *csr;
+    graph_pagerank_opts_t opts = {0};
+    graph_pagerank_stats_t stats;
+    double *scores;
+    vertex_t *v;
+
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_vertex(graph, "San Francisco") ||
+        !graph_add_vertex(graph, "Seattle") ||
+        !graph_add_vertex(graph, "New York") ||
+        !graph_add_vertex(graph, "Miami") ||
+        !graph_add_vertex(graph, "Chicago") ||
+        !graph_add_vertex(graph, "Houston") ||
+        !graph_add_vertex(graph, "Las Vegas") ||
+        !graph_add_vertex(graph, "Boston"))
+    {
+        fprintf(stderr, "Failed to add vertex\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_edge(graph, "San Francisco", "Las Vegas", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Boston", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Miami", "San Francisco", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Houston", "Seattle", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Chicago", "New York", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Las Vegas", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Chicago", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "New York", "Houston", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Miami", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "San Francisco", "Boston", BIDIRECTIONAL))
+    {
+        fprintf(stderr, "Failed to add edge\n");
+        return (EXIT_FAILURE);
+    }
+
+    csr = graph_freeze(graph);
+    scores = malloc(graph->nb_indices * sizeof(double));
+    if (!csr || !scores)
+    {
+        fprintf(stderr, "Failed to freeze graph\n");
+        return (EXIT_FAILURE);
+    }
+    opts.damping = GRAPH_PAGERANK_DAMPING;
+    opts.max_iters = 200;
+    opts.tolerance = 1e-8;
+    opts.progress = progress;
+    opts.stats = &stats;
+    if (!csr_pagerank(csr, &opts, scores))
+    {
+        fprintf(stderr, "Failed to compute PageRank\n");
+        return (EXIT_FAILURE);
+    }
+    printf("Converged after %lu iterations\n", stats.iterations);
+    for (v = graph->vertices; v; v = v->next)
+        printf("[%lu] %s: %.4f\n", v->index, v->content, scores[v->index]);
+
+    free(scores);
+    graph_csr_delete(csr);
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * graph_pagerank - Computes the PageRank of every vertex of a graph
+ *
+ * @graph: Pointer to the graph
+ * @damping: Probability of following an edge rather than jumping to a
+ *   random vertex, usually GRAPH_PAGERANK_DAMPING
+ * @iters: Number of iterations to run, 0 for GRAPH_PAGERANK_ITERS
+ * @scores: Array of graph->nb_indices entries, where to store the score
+ *   of every vertex index. Removed vertices get 0.
+ *
+ * The graph is frozen into a CSR snapshot with its reverse index, which
+ * is then run through csr_pagerank on all the online processors. Use
+ * csr_pagerank directly to reuse a snapshot, stop on a tolerance or time
+ * the iterations.
+ *
+ * Return: The number of iterations run, or 0 on failure
+ */
+size_t graph_pagerank(const graph_t *graph, double damping, size_t iters,
+		      double *scores)
+{
+	graph_pagerank_opts_t opts = {0};
+	graph_csr_t *csr;
+	size_t done;
+
+	csr = graph_freeze(graph);
+	if (!csr)
+		return (0);
+	opts.damping = damping;
+	opts.max_iters = iters;
+	done = csr_pagerank(csr, &opts, scores);
+	graph_csr_delete(csr);
+	return (done);
+}
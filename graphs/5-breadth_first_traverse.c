@@ -4,22 +4,25 @@
 /**
  * process_bfs - Helper function to process the BFS queue
  *
- * @queue: Queue of vertices
- * @depths: Array of depths
- * @visited: Array of visited flags
+ * @start: Vertex to start the traversal from
+ * @ctx: Traversal context, begun for the traversed graph
  * @action: Action to perform on each vertex
- * @write: Current write index in the queue
  *
  * Return: The maximum depth reached
  */
-static size_t process_bfs(vertex_t **queue, size_t *depths, int *visited,
-			  void (*action)(const vertex_t *v, size_t depth),
-			  size_t write)
+static size_t process_bfs(const vertex_t *start, graph_traversal_ctx_t *ctx,
+			  void (*action)(const vertex_t *v, size_t depth))
 {
-	size_t read = 0, max_depth = 0;
-	vertex_t *v;
+	const vertex_t **queue = ctx->queue;
+	size_t *depths = ctx->depths;
+	size_t read = 0, write = 1, max_depth = 0;
+	const vertex_t *v;
 	edge_t *edge;
 
+	queue[0] = start;
+	depths[0] = 0;
+	ctx->marks[start->index] = ctx->epoch;
+
 	while (read < write)
 	{
 		v = queue[read];
@@ -31,9 +34,9 @@ static size_t process_bfs(vertex_t **queue, size_t *depths, int *visited,
 		edge = v->edges;
 		while (edge)
 		{
-			if (!visited[edge->dest->index])
+			if (ctx->marks[edge->dest->index] != ctx->epoch)
 			{
-				visited[edge->dest->index] = 1;
+				ctx->marks[edge->dest->index] = ctx->epoch;
 				queue[write] = edge->dest;
 				depths[write] = depths[read] + 1;
 				write++;
@@ -46,44 +49,48 @@ static size_t process_bfs(vertex_t **queue, size_t *depths, int *visited,
 }
 
 /**
- * breadth_first_traverse - Goes through a graph using the breadth-first algo
+ * breadth_first_traverse_ctx - Goes through a graph using the breadth-first
+ * algorithm, with working memory reused from previous traversals
  *
  * @graph: Pointer to the graph to traverse
+ * @ctx: Traversal context to work in, or NULL to use a temporary one
+ * @start: Vertex to start from, or NULL to start from the head of the graph
  * @action: Pointer to the function to be called for each visited vertex
  *
  * Return: The biggest vertex depth, or 0 on failure
  */
-size_t breadth_first_traverse(const graph_t *graph,
-			      void (*action)(const vertex_t *v, size_t depth))
+size_t breadth_first_traverse_ctx(const graph_t *graph,
+				  graph_traversal_ctx_t *ctx,
+				  const vertex_t *start,
+				  void (*action)(const vertex_t *v,
+						 size_t depth))
 {
-	int *visited;
-	vertex_t **queue;
-	size_t *depths;
+	graph_traversal_ctx_t *own = NULL;
 	size_t max_depth = 0;
 
 	if (!graph || !graph->vertices || !action)
 		return (0);
 
-	visited = calloc(graph->nb_vertices, sizeof(int));
-	queue = malloc(graph->nb_vertices * sizeof(vertex_t *));
-	depths = malloc(graph->nb_vertices * sizeof(size_t));
+	if (!ctx)
+		ctx = own = graph_traversal_ctx_create(graph->nb_indices);
+	if (ctx && graph_traversal_ctx_begin(ctx, graph->nb_indices))
+		max_depth = process_bfs(start ? start : graph->vertices, ctx,
+					action);
 
-	if (!visited || !queue || !depths)
-	{
-		free(visited);
-		free(queue);
-		free(depths);
-		return (0);
-	}
-
-	queue[0] = graph->vertices;
-	depths[0] = 0;
-	visited[graph->vertices->index] = 1;
-
-	max_depth = process_bfs(queue, depths, visited, action, 1);
-
-	free(visited);
-	free(queue);
-	free(depths);
+	graph_traversal_ctx_delete(own);
 	return (max_depth);
 }
+
+/**
+ * breadth_first_traverse - Goes through a graph using the breadth-first algo
+ *
+ * @graph: Pointer to the graph to traverse
+ * @action: Pointer to the function to be called for each visited vertex
+ *
+ * Return: The biggest vertex depth, or 0 on failure
+ */
+size_t breadth_first_traverse(const graph_t *graph,
+			      void (*action)(const vertex_t *v, size_t depth))
+{
+	return (breadth_first_traverse_ctx(graph, NULL, NULL, action));
+}
@@ -0,0 +1,25 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * graph_find_vertex - Retrieves a vertex of a graph from its content,
+ * using the hash index of the graph
+ *
+ * @graph: Pointer to the graph to search in
+ * @str: String identifying the vertex
+ *
+ * Return: Pointer to the matching vertex, or NULL if not found
+ */
+vertex_t *graph_find_vertex(const graph_t *graph, const char *str)
+{
+	vertex_t **slot;
+
+	if (graph == NULL || str == NULL)
+		return (NULL);
+
+	slot = graph_hash_slot(graph, str);
+	if (slot == NULL)
+		return (NULL);
+
+	return (*slot);
+}
@@ -0,0 +1,62 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+/**
+ * print_lookup - Looks a city up in the graph and prints the result
+ *
+ * @graph: Pointer to the graph
+ * @str: City to look up
+ */
+static void print_lookup(const graph_t *graph, const char *str)
+{
+    vertex_t *v;
+
+    v = graph_find_vertex(graph, str);
+    if (v)
+        printf("Found \"%s\" at index %lu\n", v->content, v->index);
+    else
+        printf("\"%s\" not found\n", str);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    char name[32];
+    size_t i;
+
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    for (i = 0; i < 1000; i++)
+    {
+        sprintf(name, "City %lu", i);
+        if (!graph_add_vertex(graph, name))
+        {
+            fprintf(stderr, "Failed to add vertex\n");
+            return (EXIT_FAILURE);
+        }
+    }
+
+    print_lookup(graph, "City 0");
+    print_lookup(graph, "City 512");
+    print_lookup(graph, "City 999");
+    print_lookup(graph, "City 1000");
+
+    if (!graph_add_vertex(graph, "City 42"))
+        fprintf(stderr, "Failed to add \"City 42\"\n");
+
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
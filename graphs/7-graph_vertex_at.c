@@ -0,0 +1,19 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * graph_vertex_at - Retrieves a vertex of a graph from its index
+ *
+ * @graph: Pointer to the graph to search in
+ * @index: Index of the vertex
+ *
+ * Return: Pointer to the vertex, or NULL if @index is out of range or its
+ * vertex was removed
+ */
+vertex_t *graph_vertex_at(const graph_t *graph, size_t index)
+{
+	if (graph == NULL || index >= graph->nb_indices)
+		return (NULL);
+
+	return (graph->by_index[index]);
+}
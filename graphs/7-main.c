@@ -0,0 +1,49 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    vertex_t *v;
+    size_t i;
+
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_vertex(graph, "San Francisco") ||
+        !graph_add_vertex(graph, "Seattle") ||
+        !graph_add_vertex(graph, "New York") ||
+        !graph_add_vertex(graph, "Miami") ||
+        !graph_add_vertex(graph, "Chicago") ||
+        !graph_add_vertex(graph, "Houston") ||
+        !graph_add_vertex(graph, "Las Vegas") ||
+        !graph_add_vertex(graph, "Boston"))
+    {
+        fprintf(stderr, "Failed to add vertex\n");
+        return (EXIT_FAILURE);
+    }
+
+    for (i = graph->nb_vertices; i > 0; i--)
+    {
+        v = graph_vertex_at(graph, i - 1);
+        printf("[%lu] %s\n", v->index, v->content);
+    }
+
+    if (!graph_vertex_at(graph, graph->nb_vertices))
+        printf("No vertex at index %lu\n", graph->nb_vertices);
+
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,146 @@
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "graphs.h"
+
+/**
+ * csr_fill - Copies the adjacency linked lists of a graph into the
+ * contiguous arrays of a CSR snapshot
+ *
+ * @graph: Pointer to the graph to copy
+ * @csr: Pointer to the snapshot, with its arrays allocated
+ */
+static void csr_fill(const graph_t *graph, graph_csr_t *csr)
+{
+	const vertex_t *v;
+	const edge_t *e;
+	size_t i, pos = 0;
+
+	for (i = 0; i < csr->nb_vertices; i++)
+	{
+		v = graph->by_index[i];
+		csr->vertices[i] = v;
+		csr->offsets[i] = pos;
+		for (e = v ? v->edges : NULL; e; e = e->next)
+		{
+			if (csr->weights)
+				csr->weights[pos] = e->weight;
+			csr->targets[pos++] = e->dest->index;
+		}
+	}
+	csr->offsets[i] = pos;
+}
+
+/**
+ * graph_freeze - Builds an immutable compressed sparse row (CSR) snapshot
+ * of a graph, for fast read-only traversals
+ *
+ * @graph: Pointer to the graph to freeze
+ *
+ * The snapshot refers to the vertices of @graph, which must outlive it.
+ * Later changes made to @graph are not reflected in the snapshot. The
+ * snapshot spans the index space of @graph, removed vertices leaving
+ * empty rows, unless @graph has no vertex left, in which case the
+ * snapshot has no row.
+ *
+ * Return: Pointer to the allocated snapshot, or NULL on failure
+ */
+graph_csr_t *graph_freeze(const graph_t *graph)
+{
+	graph_csr_t *csr;
+	const vertex_t *v;
+
+	if (!graph)
+		return (NULL);
+
+	csr = calloc(1, sizeof(graph_csr_t));
+	if (!csr)
+		return (NULL);
+
+	/* Without vertices, there is no head to start a traversal from */
+	csr->nb_vertices = graph->vertices ? graph->nb_indices : 0;
+	for (v = graph->vertices; v; v = v->next)
+		csr->nb_edges += v->nb_edges;
+	csr->head = graph->vertices ? graph->vertices->index : 0;
+
+	csr->offsets = malloc((csr->nb_vertices + 1) * sizeof(size_t));
+	csr->targets = malloc((csr->nb_edges + 1) * sizeof(size_t));
+	csr->vertices = malloc((csr->nb_vertices + 1) * sizeof(vertex_t *));
+	if (graph->weighted)
+		csr->weights = malloc((csr->nb_edges + 1) * sizeof(unsigned int));
+	if (!csr->offsets || !csr->targets || !csr->vertices ||
+	    (graph->weighted && !csr->weights))
+	{
+		graph_csr_delete(csr);
+		return (NULL);
+	}
+
+	csr_fill(graph, csr);
+	return (csr);
+}
+
+/**
+ * graph_csr_reverse - Builds the reverse index of a CSR snapshot, listing
+ * the edges coming into every vertex
+ *
+ * @csr: Pointer to the snapshot
+ *
+ * Return: 1 on success (or if the index already exists), 0 on failure
+ */
+int graph_csr_reverse(graph_csr_t *csr)
+{
+	size_t *in_offsets, *in_sources, u, i;
+
+	if (!csr)
+		return (0);
+	if (csr->in_offsets)
+		return (1);
+
+	in_offsets = calloc(csr->nb_vertices + 2, sizeof(size_t));
+	in_sources = malloc((csr->nb_edges + 1) * sizeof(size_t));
+	if (!in_offsets || !in_sources)
+	{
+		free(in_offsets);
+		free(in_sources);
+		return (0);
+	}
+
+	/* Counting sort of the edges by destination */
+	for (i = 0; i < csr->nb_edges; i++)
+		in_offsets[csr->targets[i] + 2]++;
+	for (u = 2; u < csr->nb_vertices + 2; u++)
+		in_offsets[u] += in_offsets[u - 1];
+	for (u = 0; u < csr->nb_vertices; u++)
+		for (i = csr->offsets[u]; i < csr->offsets[u + 1]; i++)
+			in_sources[in_offsets[csr->targets[i] + 1]++] = u;
+
+	csr->in_offsets = in_offsets;
+	csr->in_sources = in_sources;
+	return (1);
+}
+
+/**
+ * graph_csr_delete - Deletes a CSR snapshot
+ *
+ * @csr: Pointer to the snapshot to delete
+ */
+void graph_csr_delete(graph_csr_t *csr)
+{
+	if (!csr)
+		return;
+
+	if (csr->map)
+	{
+		munmap(csr->map, csr->map_size);
+		free(csr->map_vertices);
+	}
+	else
+	{
+		free(csr->offsets);
+		free(csr->targets);
+		free(csr->weights);
+	}
+	free(csr->vertices);
+	free(csr->in_offsets);
+	free(csr->in_sources);
+	free(csr);
+}
@@ -0,0 +1,81 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * csr_dfs - Runs a depth-first traversal over a CSR snapshot, using an
+ * explicit stack instead of recursion
+ *
+ * @csr: Pointer to the snapshot to traverse
+ * @visited: Array of visited flags, zeroed
+ * @stack: Stack of vertex indices, able to hold every vertex
+ * @cursors: Position of the next edge to follow, for each stack level
+ * @action: Pointer to the function to be called for each visited vertex
+ *
+ * Return: The biggest vertex depth
+ */
+static size_t csr_dfs(const graph_csr_t *csr, unsigned char *visited,
+		      size_t *stack, size_t *cursors,
+		      void (*action)(const vertex_t *v, size_t depth))
+{
+	size_t top = 1, max_depth = 0, w;
+
+	stack[0] = csr->head;
+	cursors[0] = csr->offsets[csr->head];
+	visited[csr->head] = 1;
+	action(csr->vertices[csr->head], 0);
+
+	while (top > 0)
+	{
+		if (cursors[top - 1] == csr->offsets[stack[top - 1] + 1])
+		{
+			top--;
+			continue;
+		}
+		w = csr->targets[cursors[top - 1]++];
+		if (visited[w])
+			continue;
+
+		visited[w] = 1;
+		action(csr->vertices[w], top);
+		if (top > max_depth)
+			max_depth = top;
+		stack[top] = w;
+		cursors[top] = csr->offsets[w];
+		top++;
+	}
+	return (max_depth);
+}
+
+/**
+ * csr_depth_first_traverse - Goes through a CSR snapshot of a graph using
+ * the depth-first algorithm
+ *
+ * @csr: Pointer to the snapshot to traverse
+ * @action: Pointer to the function to be called for each visited vertex
+ *
+ * Vertices are visited in the same order as depth_first_traverse would
+ * visit them on the frozen graph.
+ *
+ * Return: The biggest vertex depth, or 0 on failure
+ */
+size_t csr_depth_first_traverse(const graph_csr_t *csr,
+				void (*action)(const vertex_t *v, size_t depth))
+{
+	unsigned char *visited;
+	size_t *stack, *cursors;
+	size_t max_depth = 0;
+
+	if (!csr || !csr->nb_vertices || !action)
+		return (0);
+
+	visited = calloc(csr->nb_vertices, sizeof(unsigned char));
+	stack = malloc(csr->nb_vertices * sizeof(size_t));
+	cursors = malloc(csr->nb_vertices * sizeof(size_t));
+	if (visited && stack && cursors)
+		max_depth = csr_dfs(csr, visited, stack, cursors, action);
+
+	free(visited);
+	free(stack);
+	free(cursors);
+	return (max_depth);
+}
@@ -0,0 +1,99 @@
+#include <stdlib.h>
+#include <limits.h>
+#include "graphs.h"
+
+#define PBFS_CHUNK 64
+#define BITS_PER_WORD (sizeof(unsigned long) * CHAR_BIT)
+
+/**
+ * pbfs_push - Appends a vertex to the local buffer of a thread
+ *
+ * @worker: Pointer to the thread state
+ * @v: Index of the vertex
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int pbfs_push(csr_pbfs_worker_t *worker, size_t v)
+{
+	size_t *local, cap;
+
+	if (worker->local_size == worker->local_cap)
+	{
+		cap = worker->local_cap ? worker->local_cap * 2 : PBFS_CHUNK;
+		local = realloc(worker->local, cap * sizeof(size_t));
+		if (!local)
+			return (0);
+		worker->local = local;
+		worker->local_cap = cap;
+	}
+	worker->local[worker->local_size++] = v;
+	return (1);
+}
+
+/**
+ * csr_pbfs_expand - Expands chunks of the current frontier of a parallel
+ * BFS until there is none left, claiming the discovered vertices with
+ * atomic operations on the visited bit set
+ *
+ * @worker: Pointer to the state of the calling thread
+ * @level: Depth of the current frontier
+ */
+void csr_pbfs_expand(csr_pbfs_worker_t *worker, size_t level)
+{
+	csr_pbfs_t *pbfs = worker->shared;
+	const graph_csr_t *csr = pbfs->csr;
+	size_t *frontier = pbfs->frontier[level & 1];
+	size_t size = pbfs->size[level & 1], lo, hi, i, v;
+	unsigned long bit, *word;
+
+	while ((lo = __atomic_fetch_add(&pbfs->cursor, PBFS_CHUNK,
+					__ATOMIC_RELAXED)) < size)
+	{
+		hi = lo + PBFS_CHUNK < size ? lo + PBFS_CHUNK : size;
+		for (; lo < hi; lo++)
+		{
+			if (pbfs->mode == BFS_ACTION_CONCURRENT)
+				pbfs->action(csr->vertices[frontier[lo]], level);
+			for (i = csr->offsets[frontier[lo]];
+			     i < csr->offsets[frontier[lo] + 1]; i++)
+			{
+				v = csr->targets[i];
+				word = &pbfs->visited[v / BITS_PER_WORD];
+				bit = 1UL << (v % BITS_PER_WORD);
+				if ((__atomic_load_n(word, __ATOMIC_RELAXED) & bit) ||
+				    (__atomic_fetch_or(word, bit, __ATOMIC_RELAXED) & bit))
+					continue;
+				if (!pbfs_push(worker, v))
+					__atomic_store_n(&pbfs->error, 1,
+							 __ATOMIC_RELAXED);
+			}
+		}
+	}
+}
+
+/**
+ * csr_pbfs_merge - Closes a level of a parallel BFS, from a single thread:
+ * reports the frontier in serial mode, then places the local buffers of
+ * all the threads in the next frontier
+ *
+ * @pbfs: Pointer to the shared state
+ * @level: Depth of the current frontier
+ */
+void csr_pbfs_merge(csr_pbfs_t *pbfs, size_t level)
+{
+	size_t *frontier = pbfs->frontier[level & 1], total = 0, i;
+
+	if (pbfs->mode == BFS_ACTION_SERIAL)
+		for (i = 0; i < pbfs->size[level & 1]; i++)
+			pbfs->action(pbfs->csr->vertices[frontier[i]], level);
+
+	for (i = 0; i < pbfs->nb_threads; i++)
+	{
+		pbfs->workers[i].offset = total;
+		total += pbfs->workers[i].local_size;
+	}
+	if (total > 0)
+		pbfs->max_depth = level + 1;
+	pbfs->size[(level + 1) & 1] = pbfs->error ? 0 : total;
+	pbfs->cursor = 0;
+}
@@ -0,0 +1,73 @@
+#include <stdlib.h>
+#include <time.h>
+#include "graphs.h"
+
+/**
+ * csr_pr_pull - Runs one PageRank iteration over the share of vertices of
+ * a thread, pulling the contributions of their in-edges
+ *
+ * @worker: Pointer to the state of the calling thread
+ *
+ * The contributions of the current iteration are only read, and those of
+ * the next one are only written for the vertices of the share, so the
+ * threads never write to the same memory.
+ */
+void csr_pr_pull(csr_pr_worker_t *worker)
+{
+	csr_pr_t *pr = worker->shared;
+	const graph_csr_t *csr = pr->csr;
+	const double *contrib = pr->contrib[pr->stats.iterations & 1];
+	double *next = pr->contrib[(pr->stats.iterations + 1) & 1], x;
+	size_t v;
+
+	worker->delta = 0;
+	worker->dangling = 0;
+	for (v = worker->lo; v < worker->hi; v++)
+	{
+		if (!csr->vertices[v])
+			continue;
+		x = pr->base + pr->opts.damping *
+			pr->sum(contrib, csr->in_sources + csr->in_offsets[v],
+				csr->in_offsets[v + 1] - csr->in_offsets[v]);
+		worker->delta += x > pr->scores[v] ? x - pr->scores[v] :
+			pr->scores[v] - x;
+		pr->scores[v] = x;
+		next[v] = x * pr->inv_degree[v];
+		if (pr->inv_degree[v] == 0)
+			worker->dangling += x;
+	}
+}
+
+/**
+ * csr_pr_merge - Closes an iteration of a PageRank computation, from a
+ * single thread: sums the results of the threads, times the iteration and
+ * decides whether to go on
+ *
+ * @pr: Pointer to the shared state
+ */
+void csr_pr_merge(csr_pr_t *pr)
+{
+	struct timespec now;
+	double dangling = 0, delta = 0;
+	size_t i;
+
+	for (i = 0; i < pr->nb_threads; i++)
+	{
+		delta += pr->workers[i].delta;
+		dangling += pr->workers[i].dangling;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	pr->stats.iterations++;
+	pr->stats.delta = delta;
+	pr->stats.seconds = (now.tv_sec - pr->tick.tv_sec) +
+		(now.tv_nsec - pr->tick.tv_nsec) / 1e9;
+	pr->stats.total_seconds += pr->stats.seconds;
+	if (pr->opts.progress)
+		pr->opts.progress(&pr->stats);
+
+	pr->base = (1 - pr->opts.damping + pr->opts.damping * dangling) /
+		pr->nb_live;
+	pr->done = pr->stats.iterations >= pr->opts.max_iters ||
+		delta <= pr->opts.tolerance;
+	clock_gettime(CLOCK_MONOTONIC, &pr->tick);
+}
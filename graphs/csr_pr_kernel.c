@@ -0,0 +1,130 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/* The vector kernels need per-function targets, and 64-bit indexes */
+#if defined(__x86_64__) && (__GNUC__ > 4 || \
+			    (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define PR_SIMD 1
+#include <immintrin.h>
+#endif
+
+/**
+ * pr_sum_scalar - Sums the contributions of a list of source vertices
+ *
+ * @contrib: Contribution of every vertex index
+ * @sources: Indexes of the source vertices
+ * @n: Number of sources
+ *
+ * Four partial sums are kept, so that the additions do not wait on each
+ * other.
+ *
+ * Return: The sum of the contributions
+ */
+static double pr_sum_scalar(const double *contrib, const size_t *sources,
+			    size_t n)
+{
+	double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+	size_t i;
+
+	for (i = 0; i + 4 <= n; i += 4)
+	{
+		s0 += contrib[sources[i]];
+		s1 += contrib[sources[i + 1]];
+		s2 += contrib[sources[i + 2]];
+		s3 += contrib[sources[i + 3]];
+	}
+	for (; i < n; i++)
+		s0 += contrib[sources[i]];
+	return ((s0 + s1) + (s2 + s3));
+}
+
+#ifdef PR_SIMD
+/**
+ * pr_sum_avx2 - Sums the contributions of a list of source vertices, four
+ * at a time with AVX2 gathers
+ *
+ * @contrib: Contribution of every vertex index
+ * @sources: Indexes of the source vertices
+ * @n: Number of sources
+ *
+ * Return: The sum of the contributions
+ */
+__attribute__((target("avx2")))
+static double pr_sum_avx2(const double *contrib, const size_t *sources,
+			  size_t n)
+{
+	__m256d acc = _mm256_setzero_pd();
+	__m256i idx;
+	double lanes[4];
+	size_t i;
+
+	for (i = 0; i + 4 <= n; i += 4)
+	{
+		idx = _mm256_loadu_si256((const __m256i *)(sources + i));
+		acc = _mm256_add_pd(acc, _mm256_i64gather_pd(contrib, idx, 8));
+	}
+	_mm256_storeu_pd(lanes, acc);
+	return (pr_sum_scalar(contrib, sources + i, n - i) +
+		((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])));
+}
+
+/**
+ * pr_sum_avx512 - Sums the contributions of a list of source vertices,
+ * eight at a time with AVX-512 gathers
+ *
+ * @contrib: Contribution of every vertex index
+ * @sources: Indexes of the source vertices
+ * @n: Number of sources
+ *
+ * Return: The sum of the contributions
+ */
+__attribute__((target("avx512f")))
+static double pr_sum_avx512(const double *contrib, const size_t *sources,
+			    size_t n)
+{
+	__m512d acc = _mm512_setzero_pd();
+	__m512i idx;
+	double lanes[8];
+	size_t i;
+
+	for (i = 0; i + 8 <= n; i += 8)
+	{
+		idx = _mm512_loadu_si512((const void *)(sources + i));
+		acc = _mm512_add_pd(acc, _mm512_i64gather_pd(idx, contrib, 8));
+	}
+	_mm512_storeu_pd(lanes, acc);
+	return (pr_sum_scalar(contrib, sources + i, n - i) +
+		(((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+		 ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]))));
+}
+#endif
+
+/**
+ * csr_pr_kernel - Picks the kernel summing the contributions of in-edges
+ *
+ * @vectorize: Set to pick the widest vector kernel the processor
+ *   supports, rather than the scalar one
+ * @lanes: Where to store the number of edges the kernel sums at a time
+ *
+ * Return: Pointer to the kernel
+ */
+csr_pr_sum_t csr_pr_kernel(int vectorize, size_t *lanes)
+{
+#ifdef PR_SIMD
+	__builtin_cpu_init();
+	if (vectorize && __builtin_cpu_supports("avx512f"))
+	{
+		*lanes = 8;
+		return (pr_sum_avx512);
+	}
+	if (vectorize && __builtin_cpu_supports("avx2"))
+	{
+		*lanes = 4;
+		return (pr_sum_avx2);
+	}
+#else
+	(void)vectorize;
+#endif
+	*lanes = 1;
+	return (pr_sum_scalar);
+}
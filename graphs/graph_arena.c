@@ -0,0 +1,100 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+#define GRAPH_ARENA_ALIGN 16
+#define GRAPH_ARENA_ROUND(n) \
+	(((n) + GRAPH_ARENA_ALIGN - 1) & ~((size_t)GRAPH_ARENA_ALIGN - 1))
+#define GRAPH_SLAB_DATA(slab) \
+	((char *)(slab) + GRAPH_ARENA_ROUND(sizeof(graph_slab_t)))
+
+/**
+ * graph_arena_create - Creates an empty arena
+ *
+ * @slab_size: Size in bytes of the slabs the arena carves memory from
+ *
+ * Return: Pointer to the created arena, or NULL on failure
+ */
+graph_arena_t *graph_arena_create(size_t slab_size)
+{
+	graph_arena_t *arena;
+
+	arena = malloc(sizeof(graph_arena_t));
+	if (arena == NULL)
+		return (NULL);
+
+	arena->slabs = NULL;
+	arena->used = 0;
+	arena->slab_size = GRAPH_ARENA_ROUND(slab_size);
+	return (arena);
+}
+
+/**
+ * graph_arena_alloc - Allocates memory from an arena
+ *
+ * @arena: Pointer to the arena
+ * @size: Number of bytes to allocate
+ *
+ * Requests that do not fit in the current slab open a new slab, big
+ * enough to hold them. The memory can only be released by deleting
+ * the whole arena.
+ *
+ * Return: Pointer to the allocated memory, or NULL on failure
+ */
+void *graph_arena_alloc(graph_arena_t *arena, size_t size)
+{
+	graph_slab_t *slab;
+	void *ptr;
+
+	size = GRAPH_ARENA_ROUND(size ? size : 1);
+	if (arena->slabs == NULL || arena->used + size > arena->slabs->size)
+	{
+		slab = malloc(GRAPH_ARENA_ROUND(sizeof(graph_slab_t)) +
+			      (size > arena->slab_size ? size : arena->slab_size));
+		if (slab == NULL)
+			return (NULL);
+		slab->size = size > arena->slab_size ? size : arena->slab_size;
+		slab->next = arena->slabs;
+		arena->slabs = slab;
+		arena->used = 0;
+	}
+
+	ptr = GRAPH_SLAB_DATA(arena->slabs) + arena->used;
+	arena->used += size;
+	return (ptr);
+}
+
+/**
+ * graph_arena_delete - Releases an arena and all the memory it handed out
+ *
+ * @arena: Pointer to the arena to delete
+ */
+void graph_arena_delete(graph_arena_t *arena)
+{
+	graph_slab_t *slab, *next;
+
+	if (arena == NULL)
+		return;
+
+	for (slab = arena->slabs; slab; slab = next)
+	{
+		next = slab->next;
+		free(slab);
+	}
+	free(arena);
+}
+
+/**
+ * graph_alloc - Allocates memory for a vertex, an edge or a string of
+ * a graph, from the arena of the graph if it has one
+ *
+ * @graph: Pointer to the graph
+ * @size: Number of bytes to allocate
+ *
+ * Return: Pointer to the allocated memory, or NULL on failure
+ */
+void *graph_alloc(graph_t *graph, size_t size)
+{
+	if (graph->arena)
+		return (graph_arena_alloc(graph->arena, size));
+	return (malloc(size));
+}
@@ -0,0 +1,111 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+/**
+ * graph_build_count - Counts the edges of every source vertex in the share
+ * of edge pairs of a thread
+ *
+ * @arg: Pointer to the state of the thread (graph_build_worker_t), whose
+ *   counts are zeroed
+ *
+ * Return: NULL
+ */
+void *graph_build_count(void *arg)
+{
+	graph_build_worker_t *worker = arg;
+	graph_build_t *build = worker->shared;
+	size_t nb_vertices = build->graph->nb_vertices, i, hi;
+	const graph_edge_pair_t *pair;
+
+	i = build->nb_pairs * worker->id / build->nb_threads;
+	hi = build->nb_pairs * (worker->id + 1) / build->nb_threads;
+	for (; i < hi; i++)
+	{
+		pair = &build->pairs[i];
+		if (pair->src >= nb_vertices || pair->dest >= nb_vertices)
+		{
+			__atomic_store_n(&build->error, 1, __ATOMIC_RELAXED);
+			continue;
+		}
+		worker->counts[pair->src]++;
+		if (build->flags & GRAPH_BUILD_BIDIRECTIONAL)
+			worker->counts[pair->dest]++;
+	}
+	return (NULL);
+}
+
+/**
+ * graph_build_scatter - Sorts the share of edge pairs of a thread by
+ * source vertex, into the targets array
+ *
+ * @arg: Pointer to the state of the thread (graph_build_worker_t), whose
+ *   counts hold the position of its first edge of every source vertex
+ *
+ * The threads own disjoint ranges of every vertex slice, and keep the
+ * order of their pairs, so the sort is stable.
+ *
+ * Return: NULL
+ */
+void *graph_build_scatter(void *arg)
+{
+	graph_build_worker_t *worker = arg;
+	graph_build_t *build = worker->shared;
+	size_t *counts = worker->counts, i, hi;
+	const graph_edge_pair_t *pair;
+
+	i = build->nb_pairs * worker->id / build->nb_threads;
+	hi = build->nb_pairs * (worker->id + 1) / build->nb_threads;
+	for (; i < hi; i++)
+	{
+		pair = &build->pairs[i];
+		build->targets[counts[pair->src]++] = pair->dest;
+		if (build->flags & GRAPH_BUILD_BIDIRECTIONAL)
+			build->targets[counts[pair->dest]++] = pair->src;
+	}
+	return (NULL);
+}
+
+/**
+ * graph_build_link - Links the sorted edges of the share of vertices of a
+ * thread, dropping the duplicates if asked to
+ *
+ * @arg: Pointer to the state of the thread (graph_build_worker_t)
+ *
+ * A destination is a duplicate when its mark already holds the index of
+ * the current source vertex plus one.
+ *
+ * Return: NULL
+ */
+void *graph_build_link(void *arg)
+{
+	graph_build_worker_t *worker = arg;
+	graph_build_t *build = worker->shared;
+	graph_t *graph = build->graph;
+	size_t *marks = worker->counts, u, hi, i;
+	vertex_t *dest;
+	int dedup = build->flags & GRAPH_BUILD_DEDUP;
+
+	memset(marks, 0, graph->nb_vertices * sizeof(size_t));
+	u = graph->nb_vertices * worker->id / build->nb_threads;
+	hi = graph->nb_vertices * (worker->id + 1) / build->nb_threads;
+	for (; u < hi; u++)
+	{
+		for (i = build->offsets[u]; i < build->offsets[u + 1]; i++)
+		{
+			dest = graph->by_index[build->targets[i]];
+			if (dedup && marks[dest->index] == u + 1)
+				continue;
+			marks[dest->index] = u + 1;
+			/*
+			 * Reserved by build_offsets, so this cannot fail. The
+			 * new graph does not track in-edges, so linking only
+			 * touches the source vertex of the thread.
+			 */
+			graph_link_edge(graph, graph->by_index[u], dest, 1,
+					graph_edge_alloc(graph,
+							 graph->by_index[u]));
+		}
+	}
+	return (NULL);
+}
@@ -0,0 +1,127 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+#define CC_CHUNK 256
+
+/**
+ * cc_find - Finds the root of the set of a vertex in a concurrent
+ * union-find forest, halving the path on the way
+ *
+ * @parent: Parent of every vertex index, a root being its own parent
+ * @x: Index of the vertex
+ *
+ * Parents only ever move to smaller indexes, and only roots get hooked,
+ * so a stale read only makes the walk a little longer.
+ *
+ * Return: Index of the root of the set of @x
+ */
+static size_t cc_find(size_t *parent, size_t x)
+{
+	size_t p, g;
+
+	p = __atomic_load_n(&parent[x], __ATOMIC_RELAXED);
+	while (p != x)
+	{
+		g = __atomic_load_n(&parent[p], __ATOMIC_RELAXED);
+		if (g != p)
+			__atomic_compare_exchange_n(&parent[x], &p, g, 1,
+						    __ATOMIC_RELAXED,
+						    __ATOMIC_RELAXED);
+		x = p;
+		p = g;
+	}
+	return (x);
+}
+
+/**
+ * cc_unite - Merges the sets of two vertices of a concurrent union-find
+ * forest, without locking
+ *
+ * @parent: Parent of every vertex index
+ * @a: Index of the first vertex
+ * @b: Index of the second vertex
+ *
+ * The root with the bigger index is hooked under the other one with a
+ * compare-and-swap, retried from the new roots if another thread hooked
+ * it first. Every set thus ends up rooted at its smallest index.
+ */
+static void cc_unite(size_t *parent, size_t a, size_t b)
+{
+	size_t tmp;
+
+	for (;;)
+	{
+		a = cc_find(parent, a);
+		b = cc_find(parent, b);
+		if (a == b)
+			return;
+		if (a < b)
+		{
+			tmp = a;
+			a = b;
+			b = tmp;
+		}
+		tmp = a;
+		if (__atomic_compare_exchange_n(&parent[a], &tmp, b, 0,
+						__ATOMIC_RELAXED,
+						__ATOMIC_RELAXED))
+			return;
+	}
+}
+
+/**
+ * graph_cc_link - Merges the ends of every edge of the graph into the
+ * same set, taking chunks of vertices until there is none left
+ *
+ * @arg: Pointer to the state shared by the threads (graph_cc_t)
+ *
+ * Return: NULL
+ */
+void *graph_cc_link(void *arg)
+{
+	graph_cc_t *cc = arg;
+	const graph_t *graph = cc->graph;
+	size_t lo, hi;
+	const edge_t *e;
+
+	while ((lo = __atomic_fetch_add(&cc->cursor, CC_CHUNK,
+					__ATOMIC_RELAXED)) < graph->nb_indices)
+	{
+		hi = lo + CC_CHUNK < graph->nb_indices ?
+			lo + CC_CHUNK : graph->nb_indices;
+		for (; lo < hi; lo++)
+		{
+			if (!graph->by_index[lo])
+				continue;
+			GRAPH_FOR_EACH_EDGE(graph->by_index[lo], e)
+				cc_unite(cc->parent, lo, e->dest->index);
+		}
+	}
+	return (NULL);
+}
+
+/**
+ * graph_cc_flatten - Points every vertex straight at the root of its set,
+ * taking chunks of vertices until there is none left
+ *
+ * @arg: Pointer to the state shared by the threads (graph_cc_t), once all
+ *   the edges are linked
+ *
+ * Return: NULL
+ */
+void *graph_cc_flatten(void *arg)
+{
+	graph_cc_t *cc = arg;
+	size_t n = cc->graph->nb_indices, lo, hi;
+
+	while ((lo = __atomic_fetch_add(&cc->cursor, CC_CHUNK,
+					__ATOMIC_RELAXED)) < n)
+	{
+		hi = lo + CC_CHUNK < n ? lo + CC_CHUNK : n;
+		for (; lo < hi; lo++)
+			__atomic_store_n(&cc->parent[lo],
+					 cc_find(cc->parent, lo),
+					 __ATOMIC_RELAXED);
+	}
+	return (NULL);
+}
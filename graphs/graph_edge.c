@@ -0,0 +1,163 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * graph_link_edge - Initializes an allocated edge and appends it to the
+ * linked list of edges of its source vertex, in constant time
+ *
+ * @graph: Graph the vertices belong to
+ * @src: Source vertex
+ * @dest: Destination vertex
+ * @weight: Weight of the edge
+ * @edge: Edge to link
+ *
+ * If @graph tracks its in-edges, the edge is also added to the in-edges of
+ * @dest, room having been reserved for it (see graph_in_reserve), and if
+ * it indexes its edges, the edge is added to the edge set of @src.
+ * Otherwise, the in-edge count of @dest is the only state of @dest
+ * touched, and it is updated atomically, so that threads linking the
+ * edges of distinct source vertices can share destinations (see
+ * graph_build_link).
+ */
+void graph_link_edge(const graph_t *graph, vertex_t *src, vertex_t *dest,
+		     unsigned int weight, edge_t *edge)
+{
+	edge->dest = dest;
+	edge->next = NULL;
+	edge->weight = weight;
+
+	if (graph->in_index)
+		graph_in_add(graph->in_index, src, edge,
+			     src->edges ? src->edges_tail : NULL);
+	if (src->edges == NULL)
+		src->edges = edge;
+	else
+		src->edges_tail->next = edge;
+	src->edges_tail = edge;
+	src->nb_edges++;
+	__atomic_fetch_add(&dest->nb_in_edges, 1, __ATOMIC_RELAXED);
+	if (graph->edge_index)
+		graph_edge_set_add(src, edge);
+}
+
+/**
+ * graph_unlink_edge - Removes an edge from a graph and gives it back to
+ * the storage of its source vertex
+ *
+ * @graph: Graph the vertices belong to
+ * @src: Source vertex
+ * @edge: Edge to remove
+ * @prev: Edge before @edge in the edges of @src, or NULL if it is the
+ *   first one
+ *
+ * This takes constant expected time, the in-edge index of @graph keeping
+ * the edge before every edge (see graph_in_edge_t).
+ */
+void graph_unlink_edge(const graph_t *graph, vertex_t *src, edge_t *edge,
+		       edge_t *prev)
+{
+	if (prev)
+		prev->next = edge->next;
+	else
+		src->edges = edge->next;
+	if (src->edges_tail == edge)
+		src->edges_tail = prev;
+	if (graph->in_index)
+	{
+		if (edge->next)
+			graph_in_find(graph->in_index, edge->next)->prev = prev;
+		graph_in_remove(graph->in_index, edge);
+	}
+	src->nb_edges--;
+	edge->dest->nb_in_edges--;
+	graph_edge_set_remove(src, edge);
+	graph_edge_release(src, edge);
+}
+
+/**
+ * graph_unlink_edges - Removes the edges going from a vertex to another
+ *
+ * @graph: Graph the vertices belong to
+ * @src: Source vertex
+ * @dest: Destination vertex
+ * @all: If set, all the edges from @src to @dest are removed, otherwise
+ *   only the first one
+ *
+ * The removed edges are given back to the storage of @src.
+ *
+ * Return: The number of removed edges
+ */
+size_t graph_unlink_edges(const graph_t *graph, vertex_t *src,
+			  vertex_t *dest, int all)
+{
+	edge_t *e, *prev = NULL, *next;
+	size_t removed = 0;
+
+	for (e = src->edges; e && (all || !removed); e = next)
+	{
+		next = e->next;
+		if (e->dest != dest)
+		{
+			prev = e;
+			continue;
+		}
+		graph_unlink_edge(graph, src, e, prev);
+		removed++;
+	}
+	return (removed);
+}
+
+/**
+ * graph_connect - Adds an edge between two vertices of a graph
+ *
+ * @graph: Graph the vertices belong to
+ * @src: Source vertex
+ * @dest: Destination vertex
+ * @weight: Weight of the edge
+ * @type: Type of edge (UNIDIRECTIONAL or BIDIRECTIONAL)
+ *
+ * The storage of both directions, and their room in the in-edge index of
+ * @graph, are taken before any is linked, so no edge is created on
+ * failure. If @graph rejects duplicate edges, only the
+ * directions missing from the graph are added.
+ *
+ * Return: The number of edges added, or -1 on failure
+ */
+int graph_connect(graph_t *graph, vertex_t *src, vertex_t *dest,
+		  unsigned int weight, edge_type_t type)
+{
+	edge_t *edge = NULL, *back = NULL;
+	int fwd = 1, bwd = type == BIDIRECTIONAL, ok;
+
+	if (graph->unique_edges)
+	{
+		fwd = !graph_edge_find(src, dest);
+		bwd = bwd && !graph_edge_find(dest, src) && src != dest;
+	}
+	if (fwd)
+	{
+		edge = graph_edge_alloc(graph, src);
+		if (!edge)
+			return (-1);
+	}
+	if (bwd)
+		back = graph_edge_alloc(graph, dest);
+	ok = !bwd || back;
+	if (ok && graph->in_index)
+		ok = (!fwd || graph_in_reserve(graph->in_index, dest, 1)) &&
+			(!bwd || graph_in_reserve(graph->in_index, src, 1));
+	if (!ok)
+	{
+		if (edge)
+			graph_edge_release(src, edge);
+		if (back)
+			graph_edge_release(dest, back);
+		return (-1);
+	}
+
+	if (edge)
+		graph_link_edge(graph, src, dest, weight, edge);
+	if (back)
+		graph_link_edge(graph, dest, src, weight, back);
+	return (fwd + bwd);
+}
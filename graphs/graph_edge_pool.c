@@ -0,0 +1,110 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+#define CHUNK_EDGES(chunk) ((edge_t *)((chunk) + 1))
+
+/**
+ * graph_edge_reserve - Makes sure a number of edges can be taken from the
+ * storage of a vertex without allocating memory
+ *
+ * @graph: Graph the vertex belongs to
+ * @v: Pointer to the vertex
+ * @n: Number of edges to make room for
+ *
+ * Once the inline edges are used up, the edges are taken from chunks of
+ * doubling size. The room left in a chunk is lost when a new one is
+ * needed, so a new chunk holds all the @n edges.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_edge_reserve(graph_t *graph, vertex_t *v, size_t n)
+{
+	graph_edge_chunk_t *chunk;
+	size_t inline_room = GRAPH_INLINE_EDGES - v->nb_inline, size;
+
+	if (n <= inline_room ||
+	    (v->spill && n - inline_room <= v->spill->size - v->spill->used))
+		return (1);
+
+	size = n - inline_room;
+	if (size < GRAPH_INLINE_EDGES)
+		size = GRAPH_INLINE_EDGES;
+	if (v->spill && size < v->spill->size * 2)
+		size = v->spill->size * 2;
+	chunk = graph_alloc(graph, sizeof(graph_edge_chunk_t) +
+			    size * sizeof(edge_t));
+	if (chunk == NULL)
+		return (0);
+
+	chunk->next = v->spill;
+	chunk->size = size;
+	chunk->used = 0;
+	v->spill = chunk;
+	return (1);
+}
+
+/**
+ * graph_edge_alloc - Takes an edge from the storage of a vertex, for an
+ * edge going out of it
+ *
+ * @graph: Graph the vertex belongs to
+ * @v: Pointer to the vertex
+ *
+ * Removed edges are reused first, then the inline edges of the vertex,
+ * then its spill chunks.
+ *
+ * Return: Pointer to the unlinked edge, or NULL on failure
+ */
+edge_t *graph_edge_alloc(graph_t *graph, vertex_t *v)
+{
+	edge_t *edge;
+
+	if (v->free_edges)
+	{
+		edge = v->free_edges;
+		v->free_edges = edge->next;
+		return (edge);
+	}
+	if (v->nb_inline < GRAPH_INLINE_EDGES)
+		return (&v->inline_edges[v->nb_inline++]);
+	if (!graph_edge_reserve(graph, v, 1))
+		return (NULL);
+	return (&CHUNK_EDGES(v->spill)[v->spill->used++]);
+}
+
+/**
+ * graph_edge_release - Gives an unlinked edge back to the storage of the
+ * vertex it was taken from
+ *
+ * @v: Pointer to the vertex
+ * @edge: Pointer to the edge
+ */
+void graph_edge_release(vertex_t *v, edge_t *edge)
+{
+	edge->next = v->free_edges;
+	v->free_edges = edge;
+}
+
+/**
+ * graph_edge_storage_delete - Frees the edge set of a vertex, and its
+ * spill chunks unless they belong to the arena of the graph
+ *
+ * @graph: Graph the vertex belongs to
+ * @v: Pointer to the vertex
+ */
+void graph_edge_storage_delete(graph_t *graph, vertex_t *v)
+{
+	graph_edge_chunk_t *chunk, *next;
+
+	for (chunk = v->spill; chunk && !graph->arena; chunk = next)
+	{
+		next = chunk->next;
+		free(chunk);
+	}
+	v->spill = NULL;
+	v->free_edges = NULL;
+	v->nb_inline = 0;
+	free(v->edge_set);
+	v->edge_set = NULL;
+	v->edge_set_size = 0;
+}
@@ -0,0 +1,133 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/* Home slot of an edge, hashed on the address of its destination */
+#define SET_HOME(dest, mask) (graph_hash_ptr(dest) & (mask))
+
+/**
+ * graph_edge_set_build - Rebuilds the edge set of a vertex from its
+ * linked list of edges
+ *
+ * @v: Pointer to the vertex
+ *
+ * The set is sized to stay at most half full until the number of edges
+ * doubles. On failure, the vertex is left without a set, and lookups fall
+ * back to scanning its edges.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_edge_set_build(vertex_t *v)
+{
+	size_t size = GRAPH_EDGE_SET_MIN * 2, mask, i;
+	edge_t *e;
+
+	while (size < v->nb_edges * 4)
+		size *= 2;
+	free(v->edge_set);
+	v->edge_set = calloc(size, sizeof(edge_t *));
+	v->edge_set_size = v->edge_set ? size : 0;
+	if (!v->edge_set)
+		return (0);
+
+	mask = size - 1;
+	GRAPH_FOR_EACH_EDGE(v, e)
+	{
+		for (i = SET_HOME(e->dest, mask); v->edge_set[i];)
+			i = (i + 1) & mask;
+		v->edge_set[i] = e;
+	}
+	return (1);
+}
+
+/**
+ * graph_edge_set_add - Adds an edge, just linked, to the edge set of its
+ * source vertex
+ *
+ * @v: Source vertex of the edge
+ * @edge: Edge to add
+ *
+ * The set is only created once the vertex has GRAPH_EDGE_SET_MIN edges,
+ * and is rebuilt twice as large when it gets half full.
+ */
+void graph_edge_set_add(vertex_t *v, edge_t *edge)
+{
+	size_t mask, i;
+
+	if (!v->edge_set && v->nb_edges < GRAPH_EDGE_SET_MIN)
+		return;
+	if (v->nb_edges * 2 > v->edge_set_size)
+	{
+		graph_edge_set_build(v);
+		return;
+	}
+
+	mask = v->edge_set_size - 1;
+	for (i = SET_HOME(edge->dest, mask); v->edge_set[i];)
+		i = (i + 1) & mask;
+	v->edge_set[i] = edge;
+}
+
+/**
+ * graph_edge_set_remove - Removes an edge from the edge set of its source
+ * vertex, if it has one
+ *
+ * @v: Source vertex of the edge
+ * @edge: Edge to remove
+ *
+ * The entries following the freed slot are shifted back, as in
+ * graph_hash_remove.
+ */
+void graph_edge_set_remove(vertex_t *v, const edge_t *edge)
+{
+	size_t mask, i, j, home;
+
+	if (!v->edge_set)
+		return;
+	mask = v->edge_set_size - 1;
+	for (i = SET_HOME(edge->dest, mask); v->edge_set[i] != edge;)
+		i = (i + 1) & mask;
+	v->edge_set[i] = NULL;
+
+	for (j = (i + 1) & mask; v->edge_set[j]; j = (j + 1) & mask)
+	{
+		home = SET_HOME(v->edge_set[j]->dest, mask);
+		if (((j - home) & mask) >= ((j - i) & mask))
+		{
+			v->edge_set[i] = v->edge_set[j];
+			v->edge_set[j] = NULL;
+			i = j;
+		}
+	}
+}
+
+/**
+ * graph_edge_find - Looks for an edge going from a vertex to another
+ *
+ * @src: Source vertex
+ * @dest: Destination vertex
+ *
+ * This takes constant expected time on vertices with an edge set, and
+ * scans the edges of the others, which have few of them.
+ *
+ * Return: Pointer to one of the edges from @src to @dest, or NULL if
+ * there is none
+ */
+edge_t *graph_edge_find(const vertex_t *src, const vertex_t *dest)
+{
+	size_t mask, i;
+	edge_t *e;
+
+	if (!src->edge_set)
+	{
+		GRAPH_FOR_EACH_EDGE(src, e)
+			if (e->dest == dest)
+				return (e);
+		return (NULL);
+	}
+
+	mask = src->edge_set_size - 1;
+	for (i = SET_HOME(dest, mask); src->edge_set[i]; i = (i + 1) & mask)
+		if (src->edge_set[i]->dest == dest)
+			return (src->edge_set[i]);
+	return (NULL);
+}
@@ -0,0 +1,41 @@
+#include <string.h>
+#include "graphs.h"
+
+/**
+ * graph_file_layout - Checks the header of a binary graph file, and
+ * locates its sections
+ *
+ * @h: Pointer to the header of the file
+ * @size: Size of the file in bytes
+ * @sections: Array of 5 section offsets to fill: content offsets, strings,
+ *   offsets, targets and weights
+ *
+ * The weights section is empty unless the file is weighted. A file may
+ * hold an empty graph, with a head of 0 and no edge. Both
+ * graph_mmap and file_breadth_first_traverse read files through this
+ * layout.
+ *
+ * Return: 1 if the header is valid and the sections fit in the file, 0
+ * otherwise
+ */
+int graph_file_layout(const graph_file_header_t *h, uint64_t size,
+		      uint64_t *sections)
+{
+	uint64_t v = h->nb_vertices, e = h->nb_edges;
+
+	if (size < sizeof(*h) ||
+	    memcmp(h->magic, GRAPH_FILE_MAGIC, sizeof(h->magic)) != 0 ||
+	    h->version != GRAPH_FILE_VERSION ||
+	    v >= size / 8 || e >= size / 8 || h->strings_size > size ||
+	    (v > 0 ? h->head >= v : h->head != 0 || e != 0))
+		return (0);
+
+	sections[0] = sizeof(*h);
+	sections[1] = sections[0] + (v + 1) * 8;
+	sections[2] = sections[1] + h->strings_size +
+		GRAPH_FILE_PAD8(h->strings_size);
+	sections[3] = sections[2] + (v + 1) * 8;
+	sections[4] = sections[3] + e * 8;
+	return (sections[4] + (h->flags & GRAPH_FILE_WEIGHTED ? e * 4 : 0) <=
+		size);
+}
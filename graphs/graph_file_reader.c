@@ -0,0 +1,101 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "graphs.h"
+
+/**
+ * graph_file_reader_init - Sets up a buffered reader of a file
+ *
+ * @reader: Pointer to the reader to set up
+ * @fd: File descriptor to read from
+ * @size: Size of the buffer of the reader
+ * @stats: Statistics to account the reads in
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_file_reader_init(graph_file_reader_t *reader, int fd, size_t size,
+			   graph_file_bfs_stats_t *stats)
+{
+	reader->fd = fd;
+	reader->buf = malloc(size);
+	reader->size = size;
+	reader->start = 0;
+	reader->len = 0;
+	reader->stats = stats;
+	return (reader->buf != NULL);
+}
+
+/**
+ * fill - Reads the window of a file starting at a position into the
+ * buffer of a reader, or straight into the destination if it is larger
+ *
+ * @reader: Pointer to the reader
+ * @pos: Position in the file
+ * @dst: Destination, used if @n does not fit in the buffer
+ * @n: Number of bytes the caller needs at @pos
+ *
+ * Return: 1 on success, 0 on a read error or a truncated file
+ */
+static int fill(graph_file_reader_t *reader, uint64_t pos, void *dst,
+		size_t n)
+{
+	unsigned char *p = n > reader->size ? dst : reader->buf;
+	size_t want = n > reader->size ? n : reader->size, got = 0;
+	ssize_t r;
+
+	while (got < n)
+	{
+		r = pread(reader->fd, p + got, want - got, pos + got);
+		if (r <= 0)
+			return (0);
+		got += r;
+		reader->stats->bytes_read += r;
+		reader->stats->reads++;
+	}
+	if (p == reader->buf)
+	{
+		reader->start = pos;
+		reader->len = got;
+	}
+	return (1);
+}
+
+/**
+ * graph_file_read - Reads bytes from a file through a buffered reader
+ *
+ * @reader: Pointer to the reader
+ * @pos: Position in the file of the bytes to read
+ * @dst: Where to copy the bytes
+ * @n: Number of bytes to read
+ *
+ * Bytes already in the buffer are not read again. Otherwise, a whole
+ * buffer is read from @pos on, so that reading a section through
+ * increasing positions streams it sequentially, and skipped parts of the
+ * section are only read if they are shorter than the buffer.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_file_read(graph_file_reader_t *reader, uint64_t pos, void *dst,
+		    size_t n)
+{
+	if (pos < reader->start || pos + n > reader->start + reader->len)
+	{
+		if (!fill(reader, pos, dst, n))
+			return (0);
+		if (n > reader->size)
+			return (1);
+	}
+	memcpy(dst, reader->buf + (pos - reader->start), n);
+	return (1);
+}
+
+/**
+ * graph_file_reader_end - Releases the buffer of a reader
+ *
+ * @reader: Pointer to the reader
+ */
+void graph_file_reader_end(graph_file_reader_t *reader)
+{
+	free(reader->buf);
+	reader->buf = NULL;
+}
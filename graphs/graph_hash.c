@@ -0,0 +1,148 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+#define GRAPH_HASH_MIN_SIZE 16
+
+/**
+ * graph_hash_str - Computes the FNV-1a hash of a string
+ *
+ * @str: String to hash
+ *
+ * Return: The hash value
+ */
+size_t graph_hash_str(const char *str)
+{
+	size_t hash = (size_t)2166136261UL;
+
+	while (*str)
+	{
+		hash ^= (unsigned char)*str++;
+		hash *= (size_t)16777619UL;
+	}
+	return (hash);
+}
+
+/**
+ * graph_hash_ptr - Hashes an address with the finalizer of MurmurHash3
+ *
+ * @ptr: Address to hash
+ *
+ * Every bit of the address affects every bit of the hash, so the low bits
+ * can be used as a slot even for addresses sharing their low bits, such
+ * as records allocated on a power-of-two stride.
+ *
+ * Return: The hash value
+ */
+size_t graph_hash_ptr(const void *ptr)
+{
+	uint64_t h = (uint64_t)(uintptr_t)ptr;
+
+	h ^= h >> 33;
+	h *= UINT64_C(0xff51afd7ed558ccd);
+	h ^= h >> 33;
+	h *= UINT64_C(0xc4ceb9fe1a85ec53);
+	h ^= h >> 33;
+	return ((size_t)h);
+}
+
+/**
+ * graph_hash_slot - Probes the hash index of a graph for a string
+ *
+ * @graph: Pointer to the graph
+ * @str: String to look for
+ *
+ * Return: Pointer to the slot holding the matching vertex, or to the
+ * empty slot where it would be inserted. NULL if the index is empty.
+ */
+vertex_t **graph_hash_slot(const graph_t *graph, const char *str)
+{
+	size_t mask, i;
+
+	if (graph->table_size == 0)
+		return (NULL);
+
+	mask = graph->table_size - 1;
+	i = graph_hash_str(str) & mask;
+	while (graph->table[i] && strcmp(graph->table[i]->content, str) != 0)
+		i = (i + 1) & mask;
+
+	return (&graph->table[i]);
+}
+
+/**
+ * graph_hash_reserve - Makes sure the hash index of a graph can hold
+ * a given number of vertices while staying at most half full
+ *
+ * @graph: Pointer to the graph
+ * @nb_vertices: Number of vertices the index must be able to hold
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_hash_reserve(graph_t *graph, size_t nb_vertices)
+{
+	vertex_t **old_table;
+	size_t old_size, size, i, j;
+
+	if (nb_vertices * 2 <= graph->table_size)
+		return (1);
+
+	size = graph->table_size ? graph->table_size : GRAPH_HASH_MIN_SIZE;
+	while (nb_vertices * 2 > size)
+		size *= 2;
+
+	old_table = graph->table;
+	old_size = graph->table_size;
+	graph->table = calloc(size, sizeof(vertex_t *));
+	if (graph->table == NULL)
+	{
+		graph->table = old_table;
+		return (0);
+	}
+	graph->table_size = size;
+
+	for (i = 0; i < old_size; i++)
+	{
+		if (old_table[i] == NULL)
+			continue;
+		j = graph_hash_str(old_table[i]->content) & (size - 1);
+		while (graph->table[j])
+			j = (j + 1) & (size - 1);
+		graph->table[j] = old_table[i];
+	}
+
+	free(old_table);
+	return (1);
+}
+
+/**
+ * graph_hash_remove - Removes a vertex from the hash index of a graph
+ *
+ * @graph: Pointer to the graph
+ * @vertex: Vertex to remove, which must be in the index
+ *
+ * The entries following the freed slot in its probe sequence are shifted
+ * back into it when their home slot allows, so lookups never need
+ * tombstones.
+ */
+void graph_hash_remove(graph_t *graph, const vertex_t *vertex)
+{
+	size_t mask = graph->table_size - 1, i, j, home;
+
+	i = graph_hash_str(vertex->content) & mask;
+	while (graph->table[i] != vertex)
+		i = (i + 1) & mask;
+	graph->table[i] = NULL;
+
+	for (j = (i + 1) & mask; graph->table[j]; j = (j + 1) & mask)
+	{
+		home = graph_hash_str(graph->table[j]->content) & mask;
+		/* The entry can move back if its home is not in (i, j] */
+		if (((j - home) & mask) >= ((j - i) & mask))
+		{
+			graph->table[i] = graph->table[j];
+			graph->table[j] = NULL;
+			i = j;
+		}
+	}
+}
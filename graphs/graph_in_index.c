@@ -0,0 +1,141 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+/* Smallest number of vertex indexes and of entries of an in-edge list */
+#define IN_LISTS_MIN 16
+#define IN_ITEMS_MIN 4
+
+/**
+ * in_lists_reserve - Makes sure an in-edge index has the in-edges of a
+ * vertex index
+ *
+ * @in: Pointer to the in-edge index
+ * @index: Vertex index
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int in_lists_reserve(graph_in_index_t *in, size_t index)
+{
+	graph_in_list_t *lists;
+	size_t nb = in->nb_lists ? in->nb_lists : IN_LISTS_MIN;
+
+	if (index < in->nb_lists)
+		return (1);
+	while (nb <= index)
+		nb *= 2;
+	lists = realloc(in->lists, nb * sizeof(graph_in_list_t));
+	if (lists == NULL)
+		return (0);
+	memset(lists + in->nb_lists, 0,
+	       (nb - in->nb_lists) * sizeof(graph_in_list_t));
+	in->lists = lists;
+	in->nb_lists = nb;
+	return (1);
+}
+
+/**
+ * graph_in_reserve - Makes room in an in-edge index for edges about to be
+ * linked, so that linking them cannot fail
+ *
+ * @in: Pointer to the in-edge index
+ * @dest: Destination vertex of the edges
+ * @n: Number of edges
+ *
+ * Every reserved edge stands for one graph_in_add, or one
+ * graph_in_unreserve if it ends up not being linked.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_in_reserve(graph_in_index_t *in, const vertex_t *dest, size_t n)
+{
+	graph_in_list_t *list;
+	graph_in_edge_t *items;
+	size_t size;
+
+	if (!in_lists_reserve(in, dest->index) ||
+	    !graph_in_table_reserve(in, n))
+		return (0);
+
+	/* One more entry for the end marker */
+	list = &in->lists[dest->index];
+	size = list->size ? list->size : IN_ITEMS_MIN;
+	while (size < list->count + list->reserved + n + 1)
+		size *= 2;
+	if (size != list->size)
+	{
+		items = realloc(list->items, size * sizeof(graph_in_edge_t));
+		if (items == NULL)
+			return (0);
+		if (list->items == NULL)
+			items[0].edge = NULL;
+		list->items = items;
+		list->size = size;
+	}
+	list->reserved += n;
+	in->reserved += n;
+	return (1);
+}
+
+/**
+ * graph_in_unreserve - Gives back the room reserved in an in-edge index
+ * for an edge that is not linked after all
+ *
+ * @in: Pointer to the in-edge index
+ * @dest: Destination vertex of the edge
+ */
+void graph_in_unreserve(graph_in_index_t *in, const vertex_t *dest)
+{
+	in->lists[dest->index].reserved--;
+	in->reserved--;
+}
+
+/**
+ * graph_in_add - Adds an edge to the in-edges of its destination, in
+ * constant expected time
+ *
+ * @in: Pointer to the in-edge index, with room reserved for the edge
+ * @src: Source vertex of the edge
+ * @edge: Edge to add, its destination set
+ * @prev: Edge before @edge in the edges of @src, or NULL
+ */
+void graph_in_add(graph_in_index_t *in, vertex_t *src, edge_t *edge,
+		  edge_t *prev)
+{
+	graph_in_list_t *list = &in->lists[edge->dest->index];
+	graph_in_slot_t *slot = graph_in_slot(in, edge);
+
+	list->items[list->count].edge = edge;
+	list->items[list->count].src = src;
+	list->items[list->count].prev = prev;
+	slot->edge = edge;
+	slot->pos = list->count++;
+	list->items[list->count].edge = NULL;
+	in->count++;
+	if (list->reserved)
+		list->reserved--;
+	if (in->reserved)
+		in->reserved--;
+}
+
+/**
+ * graph_in_remove - Removes an edge from the in-edges of its destination,
+ * in constant expected time
+ *
+ * @in: Pointer to the in-edge index
+ * @edge: Edge to remove, which must be indexed
+ *
+ * The last in-edge of the destination takes the place of the removed one.
+ */
+void graph_in_remove(graph_in_index_t *in, const edge_t *edge)
+{
+	graph_in_list_t *list = &in->lists[edge->dest->index];
+	graph_in_slot_t *slot = graph_in_slot(in, edge);
+	size_t pos = slot->pos;
+
+	graph_in_table_remove(in, slot);
+	list->items[pos] = list->items[--list->count];
+	list->items[list->count].edge = NULL;
+	if (pos < list->count)
+		graph_in_slot(in, list->items[pos].edge)->pos = pos;
+}
@@ -0,0 +1,109 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/* Smallest number of slots of the position table of an in-edge index */
+#define IN_TABLE_MIN 16
+
+/* Home slot of an edge, hashed on its address */
+#define IN_HOME(edge, mask) (graph_hash_ptr(edge) & (mask))
+
+/**
+ * graph_in_slot - Looks for an edge in the position table of an in-edge
+ * index
+ *
+ * @in: Pointer to the in-edge index, its table allocated
+ * @edge: Edge to look for
+ *
+ * Return: Pointer to the slot holding @edge, or to the free slot where it
+ * belongs if it is missing
+ */
+graph_in_slot_t *graph_in_slot(const graph_in_index_t *in,
+			       const edge_t *edge)
+{
+	size_t mask = in->size - 1, i;
+
+	for (i = IN_HOME(edge, mask);
+	     in->slots[i].edge && in->slots[i].edge != edge;)
+		i = (i + 1) & mask;
+	return (&in->slots[i]);
+}
+
+/**
+ * graph_in_find - Gives the in-edge record of an edge
+ *
+ * @in: Pointer to the in-edge index
+ * @edge: Edge to look for, which must be indexed
+ *
+ * This takes constant expected time.
+ *
+ * Return: Pointer to the record of @edge in the in-edges of its
+ * destination
+ */
+graph_in_edge_t *graph_in_find(const graph_in_index_t *in,
+			       const edge_t *edge)
+{
+	return (&in->lists[edge->dest->index].items[
+			graph_in_slot(in, edge)->pos]);
+}
+
+/**
+ * graph_in_table_reserve - Makes sure the position table of an in-edge
+ * index stays at most half full once a number of edges are added
+ *
+ * @in: Pointer to the in-edge index
+ * @n: Number of edges to make room for, besides the reserved ones
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_in_table_reserve(graph_in_index_t *in, size_t n)
+{
+	graph_in_slot_t *old = in->slots;
+	size_t old_size = in->size, size, i;
+
+	size = in->size ? in->size : IN_TABLE_MIN;
+	while (size < (in->count + in->reserved + n) * 2)
+		size *= 2;
+	if (size == in->size)
+		return (1);
+
+	in->slots = calloc(size, sizeof(graph_in_slot_t));
+	if (in->slots == NULL)
+	{
+		in->slots = old;
+		return (0);
+	}
+	in->size = size;
+	for (i = 0; i < old_size; i++)
+		if (old[i].edge)
+			*graph_in_slot(in, old[i].edge) = old[i];
+	free(old);
+	return (1);
+}
+
+/**
+ * graph_in_table_remove - Frees a slot of the position table of an
+ * in-edge index
+ *
+ * @in: Pointer to the in-edge index
+ * @slot: Slot holding the edge to remove
+ *
+ * The entries following the freed slot are shifted back, as in
+ * graph_hash_remove.
+ */
+void graph_in_table_remove(graph_in_index_t *in, graph_in_slot_t *slot)
+{
+	size_t mask = in->size - 1, i = slot - in->slots, j, home;
+
+	in->slots[i].edge = NULL;
+	for (j = (i + 1) & mask; in->slots[j].edge; j = (j + 1) & mask)
+	{
+		home = IN_HOME(in->slots[j].edge, mask);
+		if (((j - home) & mask) >= ((j - i) & mask))
+		{
+			in->slots[i] = in->slots[j];
+			in->slots[j].edge = NULL;
+			i = j;
+		}
+	}
+	in->count--;
+}
@@ -0,0 +1,34 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+#define GRAPH_INDEX_MIN_SIZE 16
+
+/**
+ * graph_index_reserve - Makes sure the index-to-vertex table of a graph
+ * can hold a given number of vertices
+ *
+ * @graph: Pointer to the graph
+ * @nb_vertices: Number of vertices the table must be able to hold
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_index_reserve(graph_t *graph, size_t nb_vertices)
+{
+	vertex_t **by_index;
+	size_t size;
+
+	if (nb_vertices <= graph->by_index_size)
+		return (1);
+
+	size = graph->by_index_size ? graph->by_index_size : GRAPH_INDEX_MIN_SIZE;
+	while (size < nb_vertices)
+		size *= 2;
+
+	by_index = realloc(graph->by_index, size * sizeof(vertex_t *));
+	if (by_index == NULL)
+		return (0);
+
+	graph->by_index = by_index;
+	graph->by_index_size = size;
+	return (1);
+}
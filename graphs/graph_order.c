@@ -0,0 +1,148 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * cmp_degree - Compares two vertices by number of edges, then by index
+ *
+ * @a: Pointer to the first vertex pointer
+ * @b: Pointer to the second vertex pointer
+ *
+ * Return: A negative, zero or positive value as for qsort
+ */
+static int cmp_degree(const void *a, const void *b)
+{
+	const vertex_t *va = *(vertex_t * const *)a;
+	const vertex_t *vb = *(vertex_t * const *)b;
+
+	if (va->nb_edges != vb->nb_edges)
+		return (va->nb_edges < vb->nb_edges ? -1 : 1);
+	if (va->index != vb->index)
+		return (va->index < vb->index ? -1 : 1);
+	return (0);
+}
+
+/**
+ * order_component - Appends the vertices reachable from a vertex to an
+ * order, breadth first
+ *
+ * @start: Vertex to start from, not seen yet
+ * @order: Order being built, also used as the queue of the traversal
+ * @n: Number of vertices already in @order
+ * @seen: Array of flags of the vertices already in @order
+ * @by_degree: If set, the newly seen neighbours of every vertex are
+ *   queued by increasing number of edges
+ *
+ * Return: The new number of vertices in @order
+ */
+static size_t order_component(vertex_t *start, vertex_t **order, size_t n,
+			      char *seen, int by_degree)
+{
+	size_t read = n, first;
+	edge_t *e;
+
+	seen[start->index] = 1;
+	order[n++] = start;
+	while (read < n)
+	{
+		first = n;
+		for (e = order[read++]->edges; e; e = e->next)
+		{
+			if (seen[e->dest->index])
+				continue;
+			seen[e->dest->index] = 1;
+			order[n++] = e->dest;
+		}
+		if (by_degree && n - first > 1)
+			qsort(order + first, n - first, sizeof(vertex_t *),
+			      cmp_degree);
+	}
+	return (n);
+}
+
+/**
+ * graph_order_degree - Sorts the vertices of a graph by number of edges,
+ * ties keeping their index order
+ *
+ * @graph: Pointer to the graph
+ * @order: Array of nb_vertices slots to store the sorted vertices in
+ * @descending: If set, the vertices with the most edges come first
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_order_degree(const graph_t *graph, vertex_t **order,
+		       int descending)
+{
+	size_t max = 0, d, *start;
+	vertex_t *v;
+
+	for (v = graph->vertices; v; v = v->next)
+		if (v->nb_edges > max)
+			max = v->nb_edges;
+	start = calloc(max + 2, sizeof(size_t));
+	if (start == NULL)
+		return (0);
+
+	for (v = graph->vertices; v; v = v->next)
+		start[(descending ? max - v->nb_edges : v->nb_edges) + 1]++;
+	for (d = 1; d <= max; d++)
+		start[d] += start[d - 1];
+	for (v = graph->vertices; v; v = v->next)
+	{
+		d = descending ? max - v->nb_edges : v->nb_edges;
+		order[start[d]++] = v;
+	}
+
+	free(start);
+	return (1);
+}
+
+/**
+ * graph_order_bfs - Orders the vertices of a graph breadth first, one
+ * connected component after the other
+ *
+ * @graph: Pointer to the graph
+ * @order: Array of nb_vertices slots to store the ordered vertices in
+ * @cuthill_mckee: If set, the components are started from their vertex
+ *   with the fewest edges, neighbours are queued by increasing number of
+ *   edges, and the order is reversed (Reverse Cuthill-McKee). Otherwise
+ *   they are started from their first vertex in index order.
+ *
+ * Only the edges going out of the vertices are followed.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_order_bfs(const graph_t *graph, vertex_t **order,
+		    int cuthill_mckee)
+{
+	size_t nb = graph->nb_vertices, n = 0, i;
+	vertex_t **starts, *v, *from, *tmp;
+	char *seen;
+
+	seen = calloc(graph->nb_indices + 1, sizeof(char));
+	starts = cuthill_mckee ? malloc((nb + 1) * sizeof(vertex_t *)) : NULL;
+	if (!seen || (cuthill_mckee &&
+		      (!starts || !graph_order_degree(graph, starts, 0))))
+	{
+		free(seen);
+		free(starts);
+		return (0);
+	}
+
+	for (i = 0, v = graph->vertices; v; v = v->next, i++)
+	{
+		from = cuthill_mckee ? starts[i] : v;
+		if (!seen[from->index])
+			n = order_component(from, order, n, seen,
+					    cuthill_mckee);
+	}
+	for (i = 0; cuthill_mckee && i < nb / 2; i++)
+	{
+		tmp = order[i];
+		order[i] = order[nb - 1 - i];
+		order[nb - 1 - i] = tmp;
+	}
+
+	free(seen);
+	free(starts);
+	return (1);
+}
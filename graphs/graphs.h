@@ -3,6 +3,42 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+
+/* Index given to the removed vertices in the permutations */
+#define GRAPH_NO_INDEX ((size_t)-1)
+
+#define GRAPH_FILE_MAGIC "GRAPHCSR"
+#define GRAPH_FILE_VERSION 1
+#define GRAPH_FILE_WEIGHTED 0x1
+/* Number of zero bytes aligning a section of n bytes on 8 bytes */
+#define GRAPH_FILE_PAD8(n) ((8 - ((n) & 7)) & 7)
+/* Depth of the vertices not visited yet by file_breadth_first_traverse */
+#define GRAPH_FILE_UNSEEN UINT32_MAX
+
+/* Number of edges stored in the vertex record itself */
+#define GRAPH_INLINE_EDGES 4
+
+/* Goes through the edges of a vertex, whatever their storage */
+#define GRAPH_FOR_EACH_EDGE(v, e) \
+	for ((e) = (v)->edges; (e); (e) = (e)->next)
+
+/* Number of edges from which a vertex gets an edge set */
+#define GRAPH_EDGE_SET_MIN 16
+
+/* Goes through the edges coming into a vertex (see graph_track_in_edges) */
+#define GRAPH_FOR_EACH_IN_EDGE(graph, v, in) \
+	for ((in) = graph_in_edges(graph, v); (in) && (in)->edge; (in)++)
+
+/* Defaults of csr_pagerank */
+#define GRAPH_PAGERANK_DAMPING 0.85
+#define GRAPH_PAGERANK_ITERS 100
+
+/* Flags of graph_build_from_edges */
+#define GRAPH_BUILD_BIDIRECTIONAL 0x1
+#define GRAPH_BUILD_DEDUP 0x2
 
 /**
  * enum edge_type_e - Enumerates the different types of
@@ -26,51 +62,976 @@ typedef struct vertex_s vertex_t;
  *
  * @dest: Pointer to the connected vertex
  * @next: Pointer to the next edge
+ * @weight: Weight of the edge, 1 unless given to graph_add_weighted_edge
  */
 typedef struct edge_s
 {
 	vertex_t *dest;
 	struct edge_s *next;
+	unsigned int weight;
 } edge_t;
 
+/**
+ * struct graph_edge_chunk_s - Contiguous block of edges a vertex spills
+ * to once its inline edges are used up. The edges follow this header.
+ *
+ * @next: Pointer to the previously allocated chunk of the vertex
+ * @size: Number of edges in the chunk
+ * @used: Number of edges of the chunk already handed out
+ */
+typedef struct graph_edge_chunk_s
+{
+	struct graph_edge_chunk_s *next;
+	size_t size;
+	size_t used;
+} graph_edge_chunk_t;
+
 /**
  * struct vertex_s - Node in the linked list of vertices in the adjacency list
  *
  * @index: Index of the vertex in the adjacency list.
  * @content: Custom data stored in the vertex (here, a string)
  * @nb_edges: Number of connections with other vertices in the graph
+ * @nb_in_edges: Number of edges of the graph pointing to this vertex
  * @edges: Pointer to the head node of the linked list of edges
+ * @edges_tail: Pointer to the last node of the linked list of edges
  * @next: Pointer to the next vertex in the adjacency linked list
  *   This pointer points to another vertex in the graph, but it
  *   doesn't stand for an edge between the two vertices
+ * @prev: Pointer to the previous vertex in the adjacency linked list, so
+ *   that a vertex is unlinked in constant time
+ * @nb_inline: Number of @inline_edges already handed out
+ * @spill: Chunk the edges are taken from once @inline_edges are used up,
+ *   chained to the previous chunks
+ * @free_edges: Removed edges, chained through their next pointer, reused
+ *   first
+ * @inline_edges: Storage of the first edges of the vertex, so that most
+ *   vertices find their edges in the same cache lines as themselves
+ * @edge_set: Open-addressing hash set of the edges of the vertex, keyed on
+ *   their destination, or NULL. Only kept if the graph indexes its edges
+ *   and the vertex has at least GRAPH_EDGE_SET_MIN edges.
+ * @edge_set_size: Number of slots in @edge_set (a power of two)
+ *
+ * The edges are linked in order whatever their storage, so the linked
+ * list of edges can be walked as usual (see GRAPH_FOR_EACH_EDGE).
  */
 struct vertex_s
 {
 	size_t index;
 	char *content;
 	size_t nb_edges;
+	size_t nb_in_edges;
 	edge_t *edges;
+	edge_t *edges_tail;
 	struct vertex_s *next;
+	struct vertex_s *prev;
+	size_t nb_inline;
+	graph_edge_chunk_t *spill;
+	edge_t *free_edges;
+	edge_t inline_edges[GRAPH_INLINE_EDGES];
+	edge_t **edge_set;
+	size_t edge_set_size;
 };
 
+/**
+ * struct graph_slab_s - Large block of memory carved by a graph arena
+ *
+ * @next: Pointer to the previously filled slab
+ * @size: Number of usable bytes following this header
+ */
+typedef struct graph_slab_s
+{
+	struct graph_slab_s *next;
+	size_t size;
+} graph_slab_t;
+
+/**
+ * struct graph_arena_s - Bump allocator backing the vertices and edges
+ * of a graph, or its string pool, released all at once when the graph is
+ * deleted
+ *
+ * @slabs: Pointer to the slab currently being filled (head of the list)
+ * @used: Number of bytes already handed out from the current slab
+ * @slab_size: Size of the slabs to allocate
+ */
+typedef struct graph_arena_s
+{
+	graph_slab_t *slabs;
+	size_t used;
+	size_t slab_size;
+} graph_arena_t;
+
+/**
+ * struct graph_strings_s - Pool of the interned strings of a graph, each
+ * stored once and never modified
+ *
+ * @table: Open-addressing hash set of the strings, at most half full
+ * @size: Number of slots in @table (0 or a power of two)
+ * @count: Number of strings in the pool
+ * @arena: Arena the strings are allocated from
+ */
+typedef struct graph_strings_s
+{
+	char **table;
+	size_t size;
+	size_t count;
+	graph_arena_t *arena;
+} graph_strings_t;
+
+/**
+ * struct graph_in_edge_s - Edge coming into a vertex, as recorded by the
+ * in-edge index of its graph
+ *
+ * @edge: Pointer to the edge
+ * @src: Pointer to the vertex the edge goes out of
+ * @prev: Pointer to the edge before @edge in the edges of @src, or NULL if
+ *   it is the first one, so that it can be unlinked in constant time
+ */
+typedef struct graph_in_edge_s
+{
+	edge_t *edge;
+	vertex_t *src;
+	edge_t *prev;
+} graph_in_edge_t;
+
+/**
+ * struct graph_in_list_s - Edges coming into a vertex
+ *
+ * @items: Array of the in-edges, in no particular order, followed by an
+ *   entry whose edge is NULL. NULL until the vertex gets an in-edge.
+ * @count: Number of in-edges in @items
+ * @size: Number of entries allocated in @items
+ * @reserved: Number of in-edges about to be added, @items having room for
+ *   them (see graph_in_reserve)
+ */
+typedef struct graph_in_list_s
+{
+	graph_in_edge_t *items;
+	size_t count;
+	size_t size;
+	size_t reserved;
+} graph_in_list_t;
+
+/**
+ * struct graph_in_slot_s - Entry of the position table of an in-edge index
+ *
+ * @edge: Pointer to the edge, or NULL if the slot is free
+ * @pos: Position of the edge in the in-edges of its destination
+ */
+typedef struct graph_in_slot_s
+{
+	const edge_t *edge;
+	size_t pos;
+} graph_in_slot_t;
+
+/**
+ * struct graph_in_index_s - Index of the edges coming into every vertex of
+ * a graph, kept aside so that graphs not tracking their in-edges pay
+ * nothing for it
+ *
+ * @lists: In-edges of every vertex index
+ * @nb_lists: Number of entries in @lists. The vertices with a bigger index
+ *   have no in-edge.
+ * @slots: Open-addressing hash table giving the position of every edge in
+ *   the in-edges of its destination, at most half full
+ * @size: Number of slots in @slots (0 or a power of two)
+ * @count: Number of edges in @slots
+ * @reserved: Number of edges about to be added, @slots having room for
+ *   them
+ */
+typedef struct graph_in_index_s
+{
+	graph_in_list_t *lists;
+	size_t nb_lists;
+	graph_in_slot_t *slots;
+	size_t size;
+	size_t count;
+	size_t reserved;
+} graph_in_index_t;
+
 /**
  * struct graph_s - Representation of a graph
  * We use an adjacency linked list to represent our graph
  *
  * @nb_vertices: Number of vertices in our graph
+ * @nb_indices: Bound of the vertex indexes, the size of the arrays indexed
+ *   by vertex. It exceeds @nb_vertices when vertices were removed, until
+ *   the graph is compacted (see graph_compact).
  * @vertices: Pointer to the head node of our adjacency linked list
+ * @vertices_tail: Pointer to the last node of our adjacency linked list
+ * @table: Open-addressing hash index of the vertices, keyed on content
+ * @table_size: Number of slots in @table (0 or a power of two)
+ * @by_index: Array mapping each vertex index to its vertex, or to NULL if
+ *   the vertex was removed
+ * @by_index_size: Number of slots allocated in @by_index
+ * @arena: Arena the vertices and edges are allocated from, or NULL if
+ *   they are allocated one by one with malloc
+ * @weighted: Set once an edge was added with graph_add_weighted_edge
+ * @strings: Pool of interned strings, holding the content of the vertices
+ * @in_index: Index of the in-edges of every vertex, or NULL if they are
+ *   not tracked. It is built by graph_track_in_edges, or the first time
+ *   graph_remove_vertex removes a vertex with in-edges, in time linear in
+ *   the size of the graph, and takes up to about 100 bytes per edge until
+ *   the graph is deleted.
+ * @edge_index: Set if the vertices with many edges keep an edge set (see
+ *   graph_index_edges)
+ * @unique_edges: Set if adding an edge that already exists is rejected
  */
 typedef struct graph_s
 {
 	size_t nb_vertices;
+	size_t nb_indices;
 	vertex_t *vertices;
+	vertex_t *vertices_tail;
+	vertex_t **table;
+	size_t table_size;
+	vertex_t **by_index;
+	size_t by_index_size;
+	graph_arena_t *arena;
+	int weighted;
+	graph_strings_t strings;
+	graph_in_index_t *in_index;
+	int edge_index;
+	int unique_edges;
 } graph_t;
 
+/**
+ * struct graph_csr_s - Immutable compressed sparse row snapshot of a graph
+ *
+ * @nb_vertices: Number of vertices (size of the index space)
+ * @nb_edges: Number of edges
+ * @head: Index of the head of the adjacency linked list, where
+ *   traversals start
+ * @offsets: Array of @nb_vertices + 1 positions in @targets. The edges of
+ *   the vertex at index i are targets[offsets[i]] to targets[offsets[i + 1]]
+ *   (excluded), in the same order as in its linked list of edges
+ * @targets: Index of the destination of every edge, grouped by source
+ * @vertices: Array mapping each index to the vertex it was frozen from,
+ *   or to NULL if no vertex has this index
+ * @weights: Weight of every edge, parallel to @targets. NULL if the graph
+ *   is not weighted, in which case every edge weighs 1.
+ * @in_offsets: Same as @offsets, for the edges coming into each vertex.
+ *   NULL until graph_csr_reverse builds the reverse index.
+ * @in_sources: Index of the source of every edge, grouped by destination
+ * @map: Start of the file mapping the arrays point into, for snapshots
+ *   loaded with graph_mmap, NULL otherwise
+ * @map_size: Size of @map in bytes
+ * @map_vertices: Vertices rebuilt from the string table of @map
+ */
+typedef struct graph_csr_s
+{
+	size_t nb_vertices;
+	size_t nb_edges;
+	size_t head;
+	size_t *offsets;
+	size_t *targets;
+	const vertex_t **vertices;
+	unsigned int *weights;
+	size_t *in_offsets;
+	size_t *in_sources;
+	void *map;
+	size_t map_size;
+	vertex_t *map_vertices;
+} graph_csr_t;
+
+/**
+ * struct graph_zip_s - Immutable compressed snapshot of a graph, with its
+ * neighbour lists stored as delta-encoded varints
+ *
+ * @nb_vertices: Number of vertices (size of the index space)
+ * @nb_edges: Number of edges
+ * @head: Index of the head of the adjacency linked list, where
+ *   traversals start
+ * @offsets: Array of @nb_vertices + 1 positions in @data. The neighbours
+ *   of the vertex at index i are encoded in data[offsets[i]] to
+ *   data[offsets[i + 1]] (excluded).
+ * @data: Encoded neighbour lists. Every list is sorted by index. Its first
+ *   neighbour is stored as its zigzag-encoded distance to the source
+ *   vertex, and every other one as its gap to the previous neighbour. Each
+ *   number is a varint: 7 bits per byte, the high bit set on every byte
+ *   but the last.
+ * @data_size: Size of @data in bytes
+ * @vertices: Array mapping each index to its vertex, or to NULL if no
+ *   vertex has this index
+ */
+typedef struct graph_zip_s
+{
+	size_t nb_vertices;
+	size_t nb_edges;
+	size_t head;
+	size_t *offsets;
+	unsigned char *data;
+	size_t data_size;
+	const vertex_t **vertices;
+} graph_zip_t;
+
+/**
+ * struct graph_zip_iter_s - Streaming decoder of the neighbour list of a
+ * vertex of a compressed snapshot
+ *
+ * @pos: Next byte to decode
+ * @end: End of the encoded list
+ * @src: Index of the vertex whose neighbours are decoded
+ * @last: Last decoded neighbour, or GRAPH_NO_INDEX before the first one
+ */
+typedef struct graph_zip_iter_s
+{
+	const unsigned char *pos;
+	const unsigned char *end;
+	size_t src;
+	size_t last;
+} graph_zip_iter_t;
+
+/**
+ * struct graph_file_header_s - Header of a binary graph file
+ * The header is followed, each section starting on an 8-byte boundary, by:
+ * - uint64_t content offsets[nb_vertices + 1] into the string table
+ * - char strings[strings_size]: the contents, each ending with a '\0'
+ * - uint64_t offsets[nb_vertices + 1] (see graph_csr_t)
+ * - uint64_t targets[nb_edges]
+ * - uint32_t weights[nb_edges], if @flags has GRAPH_FILE_WEIGHTED
+ * All the integers are stored in the byte order of the host
+ *
+ * @magic: GRAPH_FILE_MAGIC, without its terminating '\0'
+ * @version: GRAPH_FILE_VERSION
+ * @flags: Bitwise OR of GRAPH_FILE_* flags
+ * @nb_vertices: Number of vertices
+ * @nb_edges: Number of edges
+ * @head: Index of the head of the adjacency linked list
+ * @strings_size: Size of the string table in bytes
+ */
+typedef struct graph_file_header_s
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t flags;
+	uint64_t nb_vertices;
+	uint64_t nb_edges;
+	uint64_t head;
+	uint64_t strings_size;
+} graph_file_header_t;
+
+/**
+ * struct graph_file_bfs_stats_s - Progress of a breadth-first traversal
+ * streamed from a binary graph file
+ *
+ * @passes: Number of passes made over the file
+ * @visited: Number of vertices visited so far
+ * @frontier: Number of vertices found by the last pass
+ * @bytes_read: Number of bytes read from the file
+ * @reads: Number of reads issued to the file
+ */
+typedef struct graph_file_bfs_stats_s
+{
+	size_t passes;
+	size_t visited;
+	size_t frontier;
+	uint64_t bytes_read;
+	size_t reads;
+} graph_file_bfs_stats_t;
+
+/**
+ * struct graph_file_bfs_opts_s - Options of file_breadth_first_traverse
+ *
+ * @buffer_size: Size of each of the read buffers, 0 for the default
+ * @progress: Function called after every pass over the file, or NULL
+ * @stats: Where to store the statistics of the traversal, or NULL
+ */
+typedef struct graph_file_bfs_opts_s
+{
+	size_t buffer_size;
+	void (*progress)(const graph_file_bfs_stats_t *stats);
+	graph_file_bfs_stats_t *stats;
+} graph_file_bfs_opts_t;
+
+/**
+ * struct graph_file_reader_s - Buffered reader of a section of a file,
+ * read through increasing positions
+ *
+ * @fd: File descriptor to read from
+ * @buf: Buffer holding a window of the file
+ * @size: Size of @buf
+ * @start: Position in the file of the first byte of @buf
+ * @len: Number of valid bytes in @buf
+ * @stats: Statistics to account the reads in
+ */
+typedef struct graph_file_reader_s
+{
+	int fd;
+	unsigned char *buf;
+	size_t size;
+	uint64_t start;
+	size_t len;
+	graph_file_bfs_stats_t *stats;
+} graph_file_reader_t;
+
+/**
+ * struct graph_file_bfs_s - State of a breadth-first traversal streamed
+ * from a binary graph file
+ *
+ * @header: Header of the file
+ * @sections: Positions of the sections of the file (see
+ *   graph_file_layout)
+ * @readers: One reader per section of @sections but the weights
+ * @depths: Depth of every vertex, GRAPH_FILE_UNSEEN until visited
+ * @name: Buffer holding the content of the visited vertex
+ * @name_size: Size of @name
+ * @stats: Statistics of the traversal
+ * @action: Function called for each visited vertex
+ */
+typedef struct graph_file_bfs_s
+{
+	graph_file_header_t header;
+	uint64_t sections[5];
+	graph_file_reader_t readers[4];
+	uint32_t *depths;
+	char *name;
+	size_t name_size;
+	graph_file_bfs_stats_t stats;
+	void (*action)(const vertex_t *v, size_t depth);
+} graph_file_bfs_t;
+
+/**
+ * struct graph_load_opts_s - Options of graph_load_edgelist
+ *
+ * @type: Type of the edges described by the file
+ * @size_hint: Size hint of the arena backing the loaded graph, 0 for the
+ *   default size (see graph_create_arena)
+ * @unique: If set, the edges already loaded are skipped when they appear
+ *   again (see graph_index_edges)
+ */
+typedef struct graph_load_opts_s
+{
+	edge_type_t type;
+	size_t size_hint;
+	int unique;
+} graph_load_opts_t;
+
+/**
+ * struct graph_edge_pair_s - Edge given by the indexes of its ends, as
+ * passed to graph_build_from_edges
+ *
+ * @src: Index of the source vertex
+ * @dest: Index of the destination vertex
+ */
+typedef struct graph_edge_pair_s
+{
+	size_t src;
+	size_t dest;
+} graph_edge_pair_t;
+
+/**
+ * struct graph_traversal_ctx_s - Working memory of a traversal, allocated
+ * once and reused across many traversals
+ *
+ * Every traversal and iterator taking a context also accepts NULL, in which
+ * case it works in a temporary context of its own.
+ *
+ * @size: Number of vertex indices the buffers can hold
+ * @epoch: Stamp of the current traversal
+ * @marks: Epoch in which each vertex was last visited. A vertex is visited
+ *   in the current traversal if its mark equals @epoch, so starting a new
+ *   traversal only takes incrementing @epoch.
+ * @queue: Queue of vertices for breadth-first traversals
+ * @depths: Depth of each queued vertex
+ * @stack: Next edge to follow at each depth level, for depth-first
+ *   traversals
+ */
+typedef struct graph_traversal_ctx_s
+{
+	size_t size;
+	unsigned int epoch;
+	unsigned int *marks;
+	const vertex_t **queue;
+	size_t *depths;
+	const edge_t **stack;
+} graph_traversal_ctx_t;
+
+/**
+ * enum bfs_action_mode_e - Ways a parallel traversal can call its action
+ *
+ * @BFS_ACTION_SERIAL: The action is called from a single thread, for all
+ *   the vertices of a level before the next level is reported
+ * @BFS_ACTION_CONCURRENT: The action is called from the worker threads
+ *   as they expand the frontier, and must be thread-safe
+ */
+typedef enum bfs_action_mode_e
+{
+	BFS_ACTION_SERIAL = 0,
+	BFS_ACTION_CONCURRENT
+} bfs_action_mode_t;
+
+/* Define the structure temporarily for usage in the csr_pbfs_worker_t */
+typedef struct csr_pbfs_s csr_pbfs_t;
+
+/**
+ * struct csr_pbfs_worker_s - Private state of a parallel BFS thread
+ *
+ * @shared: Pointer to the state shared by all the threads
+ * @id: Rank of the thread, 0 being the calling thread
+ * @local: Vertices this thread discovered for the next level
+ * @local_size: Number of vertices in @local
+ * @local_cap: Number of slots allocated in @local
+ * @offset: Position of @local in the next frontier
+ */
+typedef struct csr_pbfs_worker_s
+{
+	csr_pbfs_t *shared;
+	size_t id;
+	size_t *local;
+	size_t local_size;
+	size_t local_cap;
+	size_t offset;
+} csr_pbfs_worker_t;
+
+/**
+ * struct csr_pbfs_s - State shared by the threads of a parallel BFS
+ *
+ * @csr: Pointer to the traversed snapshot
+ * @action: Pointer to the function to be called for each visited vertex
+ * @mode: How @action is called
+ * @nb_threads: Number of threads, including the calling thread
+ * @workers: Array of the @nb_threads private thread states
+ * @visited: Bit set of the discovered vertices, updated atomically
+ * @frontier: Current and next frontiers, swapped at every level
+ * @size: Number of vertices in each frontier
+ * @cursor: Position of the next chunk of the frontier to expand
+ * @max_depth: Depth of the last non-empty level
+ * @error: Set if a thread failed to allocate memory
+ * @gate: Mutex held while the threads are being started
+ * @barrier: Barrier synchronizing the threads between the level phases
+ */
+struct csr_pbfs_s
+{
+	const graph_csr_t *csr;
+	void (*action)(const vertex_t *v, size_t depth);
+	bfs_action_mode_t mode;
+	size_t nb_threads;
+	csr_pbfs_worker_t *workers;
+	unsigned long *visited;
+	size_t *frontier[2];
+	size_t size[2];
+	size_t cursor;
+	size_t max_depth;
+	int error;
+	pthread_mutex_t gate;
+	pthread_barrier_t barrier;
+};
+
+/**
+ * struct graph_pagerank_stats_s - Progress of a PageRank computation
+ *
+ * @iterations: Number of iterations run so far
+ * @delta: Sum of the absolute changes of the scores in the last iteration
+ * @seconds: Duration of the last iteration
+ * @total_seconds: Duration of all the iterations so far
+ * @lanes: Number of edges summed at a time: 8 with AVX-512, 4 with AVX2,
+ *   1 for the scalar code (see the vectorize option)
+ * @nb_threads: Number of threads running the iterations
+ */
+typedef struct graph_pagerank_stats_s
+{
+	size_t iterations;
+	double delta;
+	double seconds;
+	double total_seconds;
+	size_t lanes;
+	size_t nb_threads;
+} graph_pagerank_stats_t;
+
+/**
+ * struct graph_pagerank_opts_s - Options of csr_pagerank
+ *
+ * @damping: Probability of following an edge rather than jumping to a
+ *   random vertex, between 0 and 1
+ * @max_iters: Maximum number of iterations, 0 for GRAPH_PAGERANK_ITERS
+ * @tolerance: The iterations stop once the sum of the absolute changes of
+ *   the scores is at most this value
+ * @nb_threads: Number of threads to use, including the calling thread.
+ *   0 uses one thread per online processor.
+ * @vectorize: Set to sum the in-edges of every vertex with AVX-512 or
+ *   AVX2 gathers, if the processor has them, rather than with scalar
+ *   loads. Gathers are not faster on every processor: measure first.
+ * @progress: Function called after every iteration, or NULL
+ * @stats: Where to store the statistics of the computation, or NULL
+ */
+typedef struct graph_pagerank_opts_s
+{
+	double damping;
+	size_t max_iters;
+	double tolerance;
+	size_t nb_threads;
+	int vectorize;
+	void (*progress)(const graph_pagerank_stats_t *stats);
+	graph_pagerank_stats_t *stats;
+} graph_pagerank_opts_t;
+
+/* Sum of contributions over a list of source vertices */
+typedef double (*csr_pr_sum_t)(const double *contrib, const size_t *sources,
+			       size_t n);
+
+/* Define the structure temporarily for usage in the csr_pr_worker_t */
+typedef struct csr_pr_s csr_pr_t;
+
+/**
+ * struct csr_pr_worker_s - Private state of a PageRank thread
+ *
+ * @shared: Pointer to the state shared by all the threads
+ * @id: Rank of the thread, 0 being the calling thread
+ * @lo: First vertex index of the share of the thread
+ * @hi: End of the share of the thread
+ * @delta: Sum of the absolute changes of the scores of the share in the
+ *   last iteration
+ * @dangling: Sum of the scores of the vertices of the share without any
+ *   out-edge
+ */
+typedef struct csr_pr_worker_s
+{
+	csr_pr_t *shared;
+	size_t id;
+	size_t lo;
+	size_t hi;
+	double delta;
+	double dangling;
+} csr_pr_worker_t;
+
+/**
+ * struct csr_pr_s - State shared by the threads of a PageRank computation
+ *
+ * @csr: Pointer to the snapshot, with its reverse index
+ * @opts: Options of the computation
+ * @sum: Kernel summing the contributions of the in-edges of a vertex
+ * @nb_threads: Number of threads, including the calling thread
+ * @workers: Array of the @nb_threads private thread states
+ * @scores: Score of every vertex index
+ * @contrib: Share of its score every vertex gives to each of its edges,
+ *   for the current iteration and the next one
+ * @inv_degree: Inverse of the number of out-edges of every vertex, 0 for
+ *   the vertices without any
+ * @base: Score every vertex gets before its in-edges are summed: the
+ *   random jumps and the scores of the dangling vertices, spread evenly
+ * @nb_live: Number of vertices, not counting the unused indexes
+ * @done: Set once the iterations are over
+ * @tick: Time at which the current iteration started
+ * @stats: Statistics of the computation
+ * @gate: Mutex held while the threads are being started
+ * @barrier: Barrier synchronizing the threads between the phases of
+ *   every iteration
+ */
+struct csr_pr_s
+{
+	const graph_csr_t *csr;
+	graph_pagerank_opts_t opts;
+	csr_pr_sum_t sum;
+	size_t nb_threads;
+	csr_pr_worker_t *workers;
+	double *scores;
+	double *contrib[2];
+	double *inv_degree;
+	double base;
+	size_t nb_live;
+	int done;
+	struct timespec tick;
+	graph_pagerank_stats_t stats;
+	pthread_mutex_t gate;
+	pthread_barrier_t barrier;
+};
+
+/* Define the structure temporarily for usage in the graph_build_worker_t */
+typedef struct graph_build_s graph_build_t;
+
+/**
+ * struct graph_build_worker_s - Private state of a graph building thread
+ *
+ * @shared: Pointer to the state shared by all the threads
+ * @id: Rank of the thread, 0 being the calling thread
+ * @counts: Number of edges of every source vertex in the share of edge
+ *   pairs of the thread, turned into scatter cursors by the prefix sum,
+ *   then reused as duplicate marks
+ */
+typedef struct graph_build_worker_s
+{
+	graph_build_t *shared;
+	size_t id;
+	size_t *counts;
+} graph_build_worker_t;
+
+/**
+ * struct graph_build_s - State shared by the threads of a bulk graph build
+ *
+ * @graph: Pointer to the graph being built, its vertices already created
+ * @pairs: Array of edge pairs to build the edges from
+ * @nb_pairs: Number of pairs in @pairs
+ * @flags: GRAPH_BUILD_* flags
+ * @nb_threads: Number of threads, including the calling thread
+ * @workers: Array of the @nb_threads private thread states
+ * @offsets: Position of the edges of every vertex in @targets
+ * @targets: Destination index of every edge, sorted by source
+ * @error: Set if an edge pair refers to a missing vertex
+ */
+struct graph_build_s
+{
+	graph_t *graph;
+	const graph_edge_pair_t *pairs;
+	size_t nb_pairs;
+	int flags;
+	size_t nb_threads;
+	graph_build_worker_t *workers;
+	size_t *offsets;
+	size_t *targets;
+	int error;
+};
+
+/**
+ * struct graph_cc_s - State shared by the threads of a connected
+ * components search
+ *
+ * @graph: Pointer to the searched graph
+ * @parent: Union-find forest: parent of every vertex index, updated
+ *   atomically, a root being its own parent
+ * @nb_threads: Number of threads, including the calling thread
+ * @cursor: First vertex index of the next chunk to process
+ */
+typedef struct graph_cc_s
+{
+	const graph_t *graph;
+	size_t *parent;
+	size_t nb_threads;
+	size_t cursor;
+} graph_cc_t;
+
+/**
+ * struct graph_scc_frame_s - Frame of the explicit call stack of a
+ * strongly connected components search
+ *
+ * @v: Vertex being visited
+ * @e: Next edge of @v to follow
+ * @root: Cleared once @v reaches a vertex visited before it
+ */
+typedef struct graph_scc_frame_s
+{
+	const vertex_t *v;
+	const edge_t *e;
+	int root;
+} graph_scc_frame_t;
+
+/**
+ * struct graph_scc_s - State of a strongly connected components search
+ *
+ * @graph: Pointer to the searched graph
+ * @rindex: Visit index of every vertex index, lowered to the smallest
+ *   one it reaches, then replaced by the number of its component. 0 until
+ *   the vertex is visited.
+ * @stack: Visited vertices whose component is not known yet
+ * @top: Number of vertices in @stack
+ * @frames: Explicit call stack of the depth-first search
+ * @index: Visit index of the next vertex
+ * @c: Number of the next component, counting down
+ */
+typedef struct graph_scc_s
+{
+	const graph_t *graph;
+	size_t *rindex;
+	size_t *stack;
+	size_t top;
+	graph_scc_frame_t *frames;
+	size_t index;
+	size_t c;
+} graph_scc_t;
+
+/**
+ * enum graph_order_e - Vertex orders graph_reorder can renumber a graph in
+ *
+ * @GRAPH_ORDER_RCM: Reverse Cuthill-McKee order, keeping the neighbours
+ *   of a vertex close to it in the index space
+ * @GRAPH_ORDER_DEGREE: Vertices sorted by decreasing number of edges
+ * @GRAPH_ORDER_BFS: Breadth-first order from the head of the graph
+ */
+typedef enum graph_order_e
+{
+	GRAPH_ORDER_RCM = 0,
+	GRAPH_ORDER_DEGREE,
+	GRAPH_ORDER_BFS
+} graph_order_t;
+
+/**
+ * enum graph_walk_e - Values returned by the actions of the traversals
+ * that can be cut short
+ *
+ * @GRAPH_WALK_CONTINUE: Keep going
+ * @GRAPH_WALK_PRUNE: Do not follow the edges of the current vertex
+ * @GRAPH_WALK_STOP: End the traversal right away
+ */
+typedef enum graph_walk_e
+{
+	GRAPH_WALK_CONTINUE = 0,
+	GRAPH_WALK_PRUNE,
+	GRAPH_WALK_STOP
+} graph_walk_t;
+
+/**
+ * struct graph_bfs_iter_s - Pull-style breadth-first iterator
+ *
+ * @graph: Pointer to the traversed graph
+ * @ctx: Traversal context holding the queue and the visited marks
+ * @own_ctx: Set if @ctx was created by the iterator
+ * @read: Position of the next vertex to return in the queue
+ * @write: End of the queue
+ * @pending: Last returned vertex, whose edges are followed on the next
+ *   call, unless the iterator is pruned
+ */
+typedef struct graph_bfs_iter_s
+{
+	const graph_t *graph;
+	graph_traversal_ctx_t *ctx;
+	int own_ctx;
+	size_t read;
+	size_t write;
+	const vertex_t *pending;
+} graph_bfs_iter_t;
+
+/**
+ * struct graph_dfs_iter_s - Pull-style depth-first iterator
+ *
+ * @graph: Pointer to the traversed graph
+ * @ctx: Traversal context holding the stack and the visited marks
+ * @own_ctx: Set if @ctx was created by the iterator
+ * @top: Number of levels in the stack
+ * @start: Starting vertex, until it is returned
+ * @can_prune: Set right after a vertex is returned
+ */
+typedef struct graph_dfs_iter_s
+{
+	const graph_t *graph;
+	graph_traversal_ctx_t *ctx;
+	int own_ctx;
+	size_t top;
+	const vertex_t *start;
+	int can_prune;
+} graph_dfs_iter_t;
+
 graph_t *graph_create(void);
+graph_t *graph_create_arena(size_t size_hint);
 vertex_t *graph_add_vertex(graph_t *graph, const char *str);
 int graph_add_edge(graph_t *graph, const char *src, const char *dest, edge_type_t type);
+int graph_add_weighted_edge(graph_t *graph, const char *src, const char *dest, unsigned int weight, edge_type_t type);
+int graph_add_edges(graph_t *graph, const char **src, const char **dest, edge_type_t *types, size_t n);
 void graph_delete(graph_t *graph);
 size_t depth_first_traverse(const graph_t *graph, void (*action)(const vertex_t *v, size_t depth));
 size_t breadth_first_traverse(const graph_t *graph, void (*action)(const vertex_t *v, size_t depth));
+size_t depth_first_traverse_ctx(const graph_t *graph, graph_traversal_ctx_t *ctx, const vertex_t *start, void (*action)(const vertex_t *v, size_t depth));
+size_t breadth_first_traverse_ctx(const graph_t *graph, graph_traversal_ctx_t *ctx, const vertex_t *start, void (*action)(const vertex_t *v, size_t depth));
+vertex_t *graph_find_vertex(const graph_t *graph, const char *str);
+vertex_t *graph_vertex_at(const graph_t *graph, size_t index);
+graph_csr_t *graph_freeze(const graph_t *graph);
+void graph_csr_delete(graph_csr_t *csr);
+int graph_csr_reverse(graph_csr_t *csr);
+int graph_save(const graph_t *graph, const char *path);
+graph_csr_t *graph_mmap(const char *path);
+graph_t *graph_load_edgelist(const char *path, const graph_load_opts_t *opts);
+const char *graph_intern(graph_t *graph, const char *str);
+size_t *graph_reorder(graph_t *graph, graph_order_t strategy);
+int graph_remove_edge(graph_t *graph, const char *src, const char *dest, edge_type_t type);
+int graph_remove_vertex(graph_t *graph, const char *str);
+size_t *graph_compact(graph_t *graph);
+graph_t *graph_build_from_edges(size_t nb_vertices, const graph_edge_pair_t *edges, size_t nb_edges, int flags);
+size_t csr_breadth_first_traverse_diropt(graph_csr_t *csr, void (*action)(const vertex_t *v, size_t depth));
+size_t csr_breadth_first_traverse_parallel(const graph_csr_t *csr, size_t nb_threads, bfs_action_mode_t mode, void (*action)(const vertex_t *v, size_t depth));
+graph_traversal_ctx_t *graph_traversal_ctx_create(size_t size);
+void graph_traversal_ctx_delete(graph_traversal_ctx_t *ctx);
+int graph_bfs_iter_init(graph_bfs_iter_t *it, const graph_t *graph, graph_traversal_ctx_t *ctx, const vertex_t *start);
+const vertex_t *graph_bfs_iter_next(graph_bfs_iter_t *it, size_t *depth);
+void graph_bfs_iter_prune(graph_bfs_iter_t *it);
+void graph_bfs_iter_end(graph_bfs_iter_t *it);
+int graph_dfs_iter_init(graph_dfs_iter_t *it, const graph_t *graph, graph_traversal_ctx_t *ctx, const vertex_t *start);
+const vertex_t *graph_dfs_iter_next(graph_dfs_iter_t *it, size_t *depth);
+void graph_dfs_iter_prune(graph_dfs_iter_t *it);
+void graph_dfs_iter_end(graph_dfs_iter_t *it);
+size_t depth_first_traverse_until(const graph_t *graph, graph_traversal_ctx_t *ctx, const vertex_t *start, graph_walk_t (*action)(const vertex_t *v, size_t depth));
+size_t breadth_first_traverse_until(const graph_t *graph, graph_traversal_ctx_t *ctx, const vertex_t *start, graph_walk_t (*action)(const vertex_t *v, size_t depth));
+size_t csr_depth_first_traverse(const graph_csr_t *csr, void (*action)(const vertex_t *v, size_t depth));
+size_t csr_breadth_first_traverse(const graph_csr_t *csr, void (*action)(const vertex_t *v, size_t depth));
+graph_zip_t *graph_csr_compress(const graph_csr_t *csr);
+void graph_zip_delete(graph_zip_t *zip);
+void graph_zip_neighbors(const graph_zip_t *zip, size_t index, graph_zip_iter_t *it);
+int graph_zip_next(graph_zip_iter_t *it, size_t *dest);
+size_t zip_depth_first_traverse(const graph_zip_t *zip, void (*action)(const vertex_t *v, size_t depth));
+size_t zip_breadth_first_traverse(const graph_zip_t *zip, void (*action)(const vertex_t *v, size_t depth));
+size_t file_breadth_first_traverse(const char *path, const graph_file_bfs_opts_t *opts, void (*action)(const vertex_t *v, size_t depth));
+int graph_track_in_edges(graph_t *graph);
+size_t graph_in_degree(const vertex_t *v);
+const graph_in_edge_t *graph_in_edges(const graph_t *graph, const vertex_t *v);
+int graph_index_edges(graph_t *graph, int reject_duplicates);
+int graph_has_edge(const graph_t *graph, const char *src, const char *dest);
+size_t breadth_first_traverse_reverse(const graph_t *graph, graph_traversal_ctx_t *ctx, const vertex_t *start, void (*action)(const vertex_t *v, size_t depth));
+size_t depth_first_traverse_reverse(const graph_t *graph, graph_traversal_ctx_t *ctx, const vertex_t *start, void (*action)(const vertex_t *v, size_t depth));
+size_t graph_connected_components(const graph_t *graph, size_t *labels, size_t *sizes, size_t nb_threads);
+size_t graph_strongly_connected_components(const graph_t *graph, size_t *labels, size_t *sizes);
+graph_t *graph_condensation(const graph_t *graph, size_t *labels);
+size_t csr_pagerank(graph_csr_t *csr, const graph_pagerank_opts_t *opts, double *scores);
+size_t graph_pagerank(const graph_t *graph, double damping, size_t iters, double *scores);
+
+/* Internal helpers shared between the graph source files */
+size_t graph_hash_str(const char *str);
+size_t graph_hash_ptr(const void *ptr);
+int graph_hash_reserve(graph_t *graph, size_t nb_vertices);
+vertex_t **graph_hash_slot(const graph_t *graph, const char *str);
+int graph_index_reserve(graph_t *graph, size_t nb_vertices);
+graph_arena_t *graph_arena_create(size_t slab_size);
+void *graph_arena_alloc(graph_arena_t *arena, size_t size);
+void graph_arena_delete(graph_arena_t *arena);
+void *graph_alloc(graph_t *graph, size_t size);
+void graph_strings_delete(graph_strings_t *strings);
+void graph_link_edge(const graph_t *graph, vertex_t *src, vertex_t *dest,
+		     unsigned int weight, edge_t *edge);
+size_t graph_unlink_edges(const graph_t *graph, vertex_t *src,
+			  vertex_t *dest, int all);
+void graph_unlink_edge(const graph_t *graph, vertex_t *src, edge_t *edge,
+		       edge_t *prev);
+int graph_connect(graph_t *graph, vertex_t *src, vertex_t *dest,
+		  unsigned int weight, edge_type_t type);
+int graph_edge_set_build(vertex_t *v);
+void graph_edge_set_add(vertex_t *v, edge_t *edge);
+void graph_edge_set_remove(vertex_t *v, const edge_t *edge);
+edge_t *graph_edge_find(const vertex_t *src, const vertex_t *dest);
+int graph_edge_reserve(graph_t *graph, vertex_t *v, size_t n);
+edge_t *graph_edge_alloc(graph_t *graph, vertex_t *v);
+void graph_edge_release(vertex_t *v, edge_t *edge);
+void graph_edge_storage_delete(graph_t *graph, vertex_t *v);
+void graph_hash_remove(graph_t *graph, const vertex_t *vertex);
+graph_in_slot_t *graph_in_slot(const graph_in_index_t *in,
+			       const edge_t *edge);
+graph_in_edge_t *graph_in_find(const graph_in_index_t *in,
+			       const edge_t *edge);
+int graph_in_table_reserve(graph_in_index_t *in, size_t n);
+void graph_in_table_remove(graph_in_index_t *in, graph_in_slot_t *slot);
+int graph_in_reserve(graph_in_index_t *in, const vertex_t *dest, size_t n);
+void graph_in_unreserve(graph_in_index_t *in, const vertex_t *dest);
+void graph_in_add(graph_in_index_t *in, vertex_t *src, edge_t *edge,
+		  edge_t *prev);
+void graph_in_remove(graph_in_index_t *in, const edge_t *edge);
+void graph_in_index_delete(graph_in_index_t *in);
+int graph_traversal_ctx_begin(graph_traversal_ctx_t *ctx, size_t size);
+void csr_pbfs_expand(csr_pbfs_worker_t *worker, size_t level);
+void csr_pbfs_merge(csr_pbfs_t *pbfs, size_t level);
+csr_pr_sum_t csr_pr_kernel(int vectorize, size_t *lanes);
+void csr_pr_pull(csr_pr_worker_t *worker);
+void csr_pr_merge(csr_pr_t *pr);
+int graph_order_degree(const graph_t *graph, vertex_t **order,
+		       int descending);
+int graph_order_bfs(const graph_t *graph, vertex_t **order,
+		    int cuthill_mckee);
+void *graph_build_count(void *arg);
+void *graph_build_scatter(void *arg);
+void *graph_build_link(void *arg);
+void *graph_cc_link(void *arg);
+void *graph_cc_flatten(void *arg);
+int graph_file_layout(const graph_file_header_t *h, uint64_t size,
+		      uint64_t *sections);
+int graph_file_reader_init(graph_file_reader_t *reader, int fd, size_t size,
+			   graph_file_bfs_stats_t *stats);
+int graph_file_read(graph_file_reader_t *reader, uint64_t pos, void *dst,
+		    size_t n);
+void graph_file_reader_end(graph_file_reader_t *reader);
 
 #endif /* _GRAPHS_H_ */
@@ -1,7 +1,6 @@
 #include "pathfinding.h"
 #include <stdlib.h>
 #include <stdio.h>
-#include <string.h>
 
 /**
  * backtracking_g_recursive - Recursive helper for backtracking on graph
@@ -16,7 +15,6 @@ int backtracking_g_recursive(vertex_t const *cur, vertex_t const *target,
 			     queue_t *queue, int *visited)
 {
 	edge_t *edge;
-	char *city_copy;
 
 	if (!cur || !target || visited[cur->index])
 		return (0);
@@ -26,24 +24,18 @@ int backtracking_g_recursive(vertex_t const *cur, vertex_t const *target,
 
 	if (cur->index == target->index)
 	{
-		city_copy = strdup(cur->content);
-		if (!city_copy)
-			return (0); /* Allocation error */
-		queue_push(queue, city_copy);
+		queue_push(queue, cur->content);
 		return (1);
 	}
 
-	for (edge = cur->edges; edge; edge = edge->next)
+	GRAPH_FOR_EACH_EDGE(cur, edge)
 	{
 		if (visited[edge->dest->index])
 			continue;
 
 		if (backtracking_g_recursive(edge->dest, target, queue, visited))
 		{
-			city_copy = strdup(cur->content);
-			if (!city_copy)
-				return (0);
-			queue_push(queue, city_copy);
+			queue_push(queue, cur->content);
 			return (1);
 		}
 	}
@@ -51,28 +43,64 @@ int backtracking_g_recursive(vertex_t const *cur, vertex_t const *target,
 	return (0);
 }
 
+/**
+ * reverse_path - Reverses a path found by backtracking_g_recursive
+ * @path: Queue holding the path from the target back to the start,
+ *   deleted by this function
+ * @max: Largest possible number of vertices in the path
+ *
+ * Return: New queue holding the path from the start to the target, or
+ * NULL on failure rather than the path in reverse
+ */
+static queue_t *reverse_path(queue_t *path, size_t max)
+{
+	queue_t *reversed_path;
+	char *city, **stack;
+	size_t count = 0;
+
+	reversed_path = queue_create();
+	stack = malloc(max * sizeof(char *));
+	if (!reversed_path || !stack)
+	{
+		queue_delete(reversed_path);
+		reversed_path = NULL;
+	}
+	while (reversed_path && (city = dequeue(path)))
+		stack[count++] = city;
+	while (reversed_path && count > 0)
+	{
+		if (!queue_push(reversed_path, stack[--count]))
+		{
+			queue_delete(reversed_path);
+			reversed_path = NULL;
+		}
+	}
+	queue_delete(path);
+	free(stack);
+	return (reversed_path);
+}
+
 /**
  * backtracking_graph - Finds the first path from start to target in a graph
  * @graph: The graph
  * @start: Starting vertex
  * @target: Target vertex
  *
+ * The path holds the interned contents of the vertices (see graph_intern):
+ * they belong to the graph and must not be freed.
+ *
  * Return: Queue containing the path (strings), or NULL on failure
  */
 queue_t *backtracking_graph(graph_t *graph, vertex_t const *start,
 			    vertex_t const *target)
 {
 	queue_t *path = NULL;
-	queue_t *reversed_path = NULL;
 	int *visited;
-	char *city;
-	void *temp_storage[2048]; /* Should be enough for typical graphs */
-	int count = 0;
 
 	if (!graph || !start || !target)
 		return (NULL);
 
-	visited = calloc(graph->nb_vertices, sizeof(int));
+	visited = calloc(graph->nb_indices, sizeof(int));
 	if (!visited)
 		return (NULL);
 
@@ -86,20 +114,7 @@ queue_t *backtracking_graph(graph_t *graph, vertex_t const *start,
 	if (backtracking_g_recursive(start, target, path, visited))
 	{
 		/* Reverse the queue similar to array backtracking */
-		reversed_path = queue_create();
-		if (reversed_path)
-		{
-			while ((city = dequeue(path)))
-			{
-				temp_storage[count++] = city;
-			}
-			while (count > 0)
-			{
-				queue_push(reversed_path, temp_storage[--count]);
-			}
-			queue_delete(path);
-			path = reversed_path;
-		}
+		path = reverse_path(path, graph->nb_vertices);
 	}
 	else
 	{
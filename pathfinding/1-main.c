@@ -16,7 +16,6 @@ static void print_free_path(queue_t *path)
     {
         char *city = (char *)dequeue(path);
         printf(" %s\n", city);
-        free(city);
     }
     free(path);
 }
@@ -33,27 +32,27 @@ int main(void)
     queue_t *path;
 
     graph = graph_create();
-    graph_add_vertex(graph, "San Francisco", 0, 0);
-    graph_add_vertex(graph, "Los Angeles", 0, 0);
-    graph_add_vertex(graph, "Las Vegas", 0, 0);
-    start = graph_add_vertex(graph, "Seattle", 0, 0);
-    graph_add_vertex(graph, "Chicago", 0, 0);
-    graph_add_vertex(graph, "Washington", 0, 0);
-    graph_add_vertex(graph, "New York", 0, 0);
-    graph_add_vertex(graph, "Houston", 0, 0);
-    graph_add_vertex(graph, "Nashville", 0, 0);
-    target = graph_add_vertex(graph, "Miami", 0, 0);
-    graph_add_edge(graph, "San Francisco", "Los Angeles", 0, BIDIRECTIONAL);
-    graph_add_edge(graph, "San Francisco", "Las Vegas", 0, BIDIRECTIONAL);
-    graph_add_edge(graph, "Los Angeles", "Las Vegas", 0, BIDIRECTIONAL);
-    graph_add_edge(graph, "San Francisco", "Seattle", 0, BIDIRECTIONAL);
-    graph_add_edge(graph, "Seattle", "Chicago", 0, BIDIRECTIONAL);
-    graph_add_edge(graph, "Chicago", "Washington", 0, BIDIRECTIONAL);
-    graph_add_edge(graph, "Washington", "New York", 0, BIDIRECTIONAL);
-    graph_add_edge(graph, "Las Vegas", "Houston", 0, BIDIRECTIONAL);
-    graph_add_edge(graph, "Houston", "Nashville", 0, BIDIRECTIONAL);
-    graph_add_edge(graph, "Nashville", "Washington", 0, BIDIRECTIONAL);
-    graph_add_edge(graph, "Nashville", "Miami", 0, BIDIRECTIONAL);
+    graph_add_vertex(graph, "San Francisco");
+    graph_add_vertex(graph, "Los Angeles");
+    graph_add_vertex(graph, "Las Vegas");
+    start = graph_add_vertex(graph, "Seattle");
+    graph_add_vertex(graph, "Chicago");
+    graph_add_vertex(graph, "Washington");
+    graph_add_vertex(graph, "New York");
+    graph_add_vertex(graph, "Houston");
+    graph_add_vertex(graph, "Nashville");
+    target = graph_add_vertex(graph, "Miami");
+    graph_add_edge(graph, "San Francisco", "Los Angeles", BIDIRECTIONAL);
+    graph_add_edge(graph, "San Francisco", "Las Vegas", BIDIRECTIONAL);
+    graph_add_edge(graph, "Los Angeles", "Las Vegas", BIDIRECTIONAL);
+    graph_add_edge(graph, "San Francisco", "Seattle", BIDIRECTIONAL);
+    graph_add_edge(graph, "Seattle", "Chicago", BIDIRECTIONAL);
+    graph_add_edge(graph, "Chicago", "Washington", BIDIRECTIONAL);
+    graph_add_edge(graph, "Washington", "New York", BIDIRECTIONAL);
+    graph_add_edge(graph, "Las Vegas", "Houston", BIDIRECTIONAL);
+    graph_add_edge(graph, "Houston", "Nashville", BIDIRECTIONAL);
+    graph_add_edge(graph, "Nashville", "Washington", BIDIRECTIONAL);
+    graph_add_edge(graph, "Nashville", "Miami", BIDIRECTIONAL);
 
     path = backtracking_graph(graph, start, target);
     if (!path)
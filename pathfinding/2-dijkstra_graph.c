@@ -1,24 +1,27 @@
 #include "pathfinding.h"
 #include <stdlib.h>
 #include <stdio.h>
-#include <string.h>
-#include <limits.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#define NO_VERTEX ((size_t)-1)
 
 /**
  * get_min_vertex - Finds the unvisited vertex with the smallest distance
  * @dists: Array of distances
  * @visited: Array of visited status
- * @nb_vertices: Number of vertices
+ * @nb_indices: Bound of the vertex indexes
  *
- * Return: Index of the vertex, or -1 if none found
+ * Return: Index of the vertex, or NO_VERTEX if none found
  */
-static int get_min_vertex(int *dists, int *visited, size_t nb_vertices)
+static size_t get_min_vertex(uint64_t *dists, int *visited,
+			     size_t nb_indices)
 {
-	int min_dist = INT_MAX;
-	int min_idx = -1;
+	uint64_t min_dist = UINT64_MAX;
+	size_t min_idx = NO_VERTEX;
 	size_t i;
 
-	for (i = 0; i < nb_vertices; i++)
+	for (i = 0; i < nb_indices; i++)
 	{
 		if (!visited[i] && dists[i] < min_dist)
 		{
@@ -29,114 +32,106 @@ static int get_min_vertex(int *dists, int *visited, size_t nb_vertices)
 	return (min_idx);
 }
 
+/**
+ * build_path - Builds the path leading to a vertex from the parents found
+ * by Dijkstra's algorithm
+ * @graph: The graph
+ * @parents: Parent of each vertex on its shortest path
+ * @target: Target vertex
+ *
+ * Return: Queue containing the path (strings), or NULL on failure
+ */
+static queue_t *build_path(graph_t *graph, vertex_t **parents,
+			   vertex_t const *target)
+{
+	queue_t *path;
+	vertex_t const *curr;
+	char **stack;
+	size_t stack_idx = 0;
+
+	path = queue_create();
+	stack = malloc(graph->nb_vertices * sizeof(char *));
+	if (!path || !stack)
+	{
+		queue_delete(path);
+		free(stack);
+		return (NULL);
+	}
+
+	for (curr = target; curr; curr = parents[curr->index])
+		stack[stack_idx++] = curr->content;
+
+	/* Push to queue in correct order (Start -> ... -> Target) */
+	while (stack_idx > 0)
+		queue_push(path, stack[--stack_idx]);
+
+	free(stack);
+	return (path);
+}
+
 /**
  * dijkstra_graph - Finds the shortest path from start to target in a graph
  * @graph: The graph
  * @start: Starting vertex
  * @target: Target vertex
  *
+ * Edges weigh their weight (see graph_add_weighted_edge), and distances
+ * are accumulated on 64 bits so that long paths cannot overflow. The path
+ * holds the interned contents of the vertices (see graph_intern): they
+ * belong to the graph and must not be freed.
+ *
  * Return: Queue containing the path (strings), or NULL on failure
  */
 queue_t *dijkstra_graph(graph_t *graph, vertex_t const *start,
 			vertex_t const *target)
 {
-	int *dists;
+	uint64_t *dists;
 	int *visited;
-	vertex_t **parents;
-	size_t i;
-	int u_idx;
-	vertex_t *u, *curr;
+	vertex_t **parents, *u;
+	size_t i, u_idx, v_idx;
 	edge_t *edge;
 	queue_t *path = NULL;
-	char *city_name;
-	void *temp_stack[2048];
-	int stack_idx = 0;
 
 	if (!graph || !start || !target)
 		return (NULL);
 
-	dists = malloc(graph->nb_vertices * sizeof(int));
-	visited = calloc(graph->nb_vertices, sizeof(int));
-	parents = calloc(graph->nb_vertices, sizeof(vertex_t *));
-
-	if (!dists || !visited || !parents)
-	{
-		free(dists);
-		free(visited);
-		free(parents);
-		return (NULL);
-	}
-
-	for (i = 0; i < graph->nb_vertices; i++)
-		dists[i] = INT_MAX;
-
-	dists[start->index] = 0;
-
-	while ((u_idx = get_min_vertex(dists, visited, graph->nb_vertices)) != -1)
+	dists = malloc(graph->nb_indices * sizeof(uint64_t));
+	visited = calloc(graph->nb_indices, sizeof(int));
+	parents = calloc(graph->nb_indices, sizeof(vertex_t *));
+	for (i = 0; dists && i < graph->nb_indices; i++)
+		dists[i] = UINT64_MAX;
+
+	if (dists && visited && parents)
+		dists[start->index] = 0;
+	while (dists && visited && parents &&
+	       (u_idx = get_min_vertex(dists, visited, graph->nb_indices)) !=
+	       NO_VERTEX)
 	{
 		visited[u_idx] = 1;
-		
-		/* Find the vertex pointer for u_idx (not efficient but structure forces it unless we map) */
-		/* Actually graphs usually store vertices in a list, not indexed array directly accessibly?
-		   Wait, graph_t has `vertex_t *vertices` which is a linked list.
-		   We need to traverse to find the vertex ptr? Or assume `nb_vertices` is consistent.
-		   The `vertex_t` struct has `index`.
-		   We can only access u if we traverse.
-		   Wait, for printing and edges we need `vertex_t *u`.
-		   Optimization: Can we map index -> vertex_t*?
-		   Since we cannot modify structs, we might need a temporary map array.
-		 */
-		u = graph->vertices;
-		while (u && u->index != (size_t)u_idx)
-			u = u->next;
-
-		if (!u) break; /* Should not happen */
-
-		printf("Checking %s, distance from %s is %d\n",
+		u = graph_vertex_at(graph, u_idx);
+		printf("Checking %s, distance from %s is %" PRIu64 "\n",
 		       u->content, start->content, dists[u_idx]);
-
 		if (u == target)
 			break; /* Found target */
 
-		for (edge = u->edges; edge; edge = edge->next)
+		GRAPH_FOR_EACH_EDGE(u, edge)
 		{
-			int v_idx = edge->dest->index;
-			int weight = edge->weight;
-
-			if (!visited[v_idx] && dists[u_idx] != INT_MAX &&
-			    dists[u_idx] + weight < dists[v_idx])
+			v_idx = edge->dest->index;
+			if (!visited[v_idx] &&
+			    dists[u_idx] + edge->weight < dists[v_idx])
 			{
-				dists[v_idx] = dists[u_idx] + weight;
+				dists[v_idx] = dists[u_idx] + edge->weight;
 				parents[v_idx] = u;
 			}
 		}
 	}
 
 	/* Reconstruct path if target reachable */
-	if (dists[target->index] != INT_MAX)
-	{
-		path = queue_create();
-		if (path)
-		{
-			curr = (vertex_t *)target;
-			while (curr)
-			{
-				city_name = strdup(curr->content);
-				temp_stack[stack_idx++] = city_name;
-				curr = parents[curr->index];
-			}
-
-			/* Push to queue in correct order (Start -> ... -> Target) */
-			while (stack_idx > 0)
-			{
-				queue_push(path, temp_stack[--stack_idx]);
-			}
-		}
-	}
+	if (dists && visited && parents && dists[target->index] != UINT64_MAX)
+		path = build_path(graph, parents, target);
 
 	free(dists);
 	free(visited);
 	free(parents);
-
 	return (path);
 }
@@ -16,7 +16,6 @@ static void print_free_path(queue_t *path)
     {
         char *city = (char *)dequeue(path);
         printf(" %s\n", city);
-        free(city);
     }
     free(path);
 }
@@ -33,27 +32,27 @@ int main(void)
     queue_t *path;
 
     graph = graph_create();
-    graph_add_vertex(graph, "San Francisco", 0, 0);
-    graph_add_vertex(graph, "Los Angeles", 0, 0);
-    graph_add_vertex(graph, "Las Vegas", 0, 0);
-    start = graph_add_vertex(graph, "Seattle", 0, 0);
-    graph_add_vertex(graph, "Chicago", 0, 0);
-    graph_add_vertex(graph, "Washington", 0, 0);
-    graph_add_vertex(graph, "New York", 0, 0);
-    graph_add_vertex(graph, "Houston", 0, 0);
-    graph_add_vertex(graph, "Nashville", 0, 0);
-    target = graph_add_vertex(graph, "Miami", 0, 0);
-    graph_add_edge(graph, "San Francisco", "Los Angeles", 347, BIDIRECTIONAL);
-    graph_add_edge(graph, "San Francisco", "Las Vegas", 417, BIDIRECTIONAL);
-    graph_add_edge(graph, "Los Angeles", "Las Vegas", 228, BIDIRECTIONAL);
-    graph_add_edge(graph, "San Francisco", "Seattle", 680, BIDIRECTIONAL);
-    graph_add_edge(graph, "Seattle", "Chicago", 1734, BIDIRECTIONAL);
-    graph_add_edge(graph, "Chicago", "Washington", 594, BIDIRECTIONAL);
-    graph_add_edge(graph, "Washington", "New York", 203, BIDIRECTIONAL);
-    graph_add_edge(graph, "Las Vegas", "Houston", 1227, BIDIRECTIONAL);
-    graph_add_edge(graph, "Houston", "Nashville", 666, BIDIRECTIONAL);
-    graph_add_edge(graph, "Nashville", "Washington", 566, BIDIRECTIONAL);
-    graph_add_edge(graph, "Nashville", "Miami", 818, BIDIRECTIONAL);
+    graph_add_vertex(graph, "San Francisco");
+    graph_add_vertex(graph, "Los Angeles");
+    graph_add_vertex(graph, "Las Vegas");
+    start = graph_add_vertex(graph, "Seattle");
+    graph_add_vertex(graph, "Chicago");
+    graph_add_vertex(graph, "Washington");
+    graph_add_vertex(graph, "New York");
+    graph_add_vertex(graph, "Houston");
+    graph_add_vertex(graph, "Nashville");
+    target = graph_add_vertex(graph, "Miami");
+    graph_add_weighted_edge(graph, "San Francisco", "Los Angeles", 347, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "San Francisco", "Las Vegas", 417, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "Los Angeles", "Las Vegas", 228, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "San Francisco", "Seattle", 680, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "Seattle", "Chicago", 1734, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "Chicago", "Washington", 594, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "Washington", "New York", 203, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "Las Vegas", "Houston", 1227, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "Houston", "Nashville", 666, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "Nashville", "Washington", 566, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "Nashville", "Miami", 818, BIDIRECTIONAL);
 
     path = dijkstra_graph(graph, start, target);
     if (!path)
@@ -16,7 +16,6 @@ static void print_free_path(queue_t *path)
     {
         char *city = (char *)dequeue(path);
         printf(" %s\n", city);
-        free(city);
     }
     free(path);
 }
@@ -33,36 +32,36 @@ int main(void)
     queue_t *path;
 
     graph = graph_create();
-    start = graph_add_vertex(graph, "A", 0, 0);
-    target = graph_add_vertex(graph, "B", 0, 0);
-    graph_add_vertex(graph, "C", 0, 0);
-    graph_add_vertex(graph, "D", 0, 0);
-    graph_add_vertex(graph, "E", 0, 0);
-    graph_add_vertex(graph, "F", 0, 0);
-    graph_add_vertex(graph, "G", 0, 0);
-    graph_add_vertex(graph, "H", 0, 0);
-    graph_add_vertex(graph, "I", 0, 0);
-    graph_add_vertex(graph, "J", 0, 0);
-    graph_add_vertex(graph, "K", 0, 0);
-    graph_add_vertex(graph, "L", 0, 0);
-    graph_add_vertex(graph, "M", 0, 0);
-    graph_add_vertex(graph, "N", 0, 0);
-    graph_add_vertex(graph, "O", 0, 0);
+    start = graph_add_vertex(graph, "A");
+    target = graph_add_vertex(graph, "B");
+    graph_add_vertex(graph, "C");
+    graph_add_vertex(graph, "D");
+    graph_add_vertex(graph, "E");
+    graph_add_vertex(graph, "F");
+    graph_add_vertex(graph, "G");
+    graph_add_vertex(graph, "H");
+    graph_add_vertex(graph, "I");
+    graph_add_vertex(graph, "J");
+    graph_add_vertex(graph, "K");
+    graph_add_vertex(graph, "L");
+    graph_add_vertex(graph, "M");
+    graph_add_vertex(graph, "N");
+    graph_add_vertex(graph, "O");
 
-    graph_add_edge(graph, "A", "B", 1000, BIDIRECTIONAL);
-    graph_add_edge(graph, "A", "C", 10, BIDIRECTIONAL);
-    graph_add_edge(graph, "C", "D", 10, BIDIRECTIONAL);
-    graph_add_edge(graph, "D", "E", 10, BIDIRECTIONAL);
-    graph_add_edge(graph, "E", "F", 10, BIDIRECTIONAL);
-    graph_add_edge(graph, "F", "G", 10, BIDIRECTIONAL);
-    graph_add_edge(graph, "G", "H", 10, BIDIRECTIONAL);
-    graph_add_edge(graph, "H", "I", 10, BIDIRECTIONAL);
-    graph_add_edge(graph, "I", "J", 10, BIDIRECTIONAL);
-    graph_add_edge(graph, "J", "K", 10, BIDIRECTIONAL);
-    graph_add_edge(graph, "K", "L", 10, BIDIRECTIONAL);
-    graph_add_edge(graph, "L", "M", 10, BIDIRECTIONAL);
-    graph_add_edge(graph, "M", "N", 10, BIDIRECTIONAL);
-    graph_add_edge(graph, "N", "O", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "A", "B", 1000, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "A", "C", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "C", "D", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "D", "E", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "E", "F", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "F", "G", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "G", "H", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "H", "I", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "I", "J", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "J", "K", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "K", "L", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "L", "M", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "M", "N", 10, BIDIRECTIONAL);
+    graph_add_weighted_edge(graph, "N", "O", 10, BIDIRECTIONAL);
 
     path = dijkstra_graph(graph, start, target);
     if (!path)